@@ -0,0 +1,116 @@
+/**
+ * @file config.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#include "./include/config.h"
+#include "./include/avl_tree.h"
+#include "./include/red_black_tree.h"
+#include "./include/hash_table_linked.h"
+#include "./include/cuckoo_hash.h"
+#include "./include/sharded_set.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Every engine that implements the common set interface,
+ * a new engine is made selectable by adding its operations here
+ * 
+ */
+static const set_ops_t * const set_engines[] = {
+    &avl_set_ops,
+    &rbk_set_ops,
+    &hash_table_set_ops,
+    &cuckoo_hash_set_ops,
+    &sharded_avl_set_ops,
+    &sharded_rbk_set_ops,
+    &sharded_hash_table_set_ops,
+};
+
+size_t scl_identity_hash(int32_t key) {
+    return (size_t)key;
+}
+
+/* Bytes an allocation takes from the heap, the asked size where the allocator does not tell */
+static size_t scl_allocated_size(void * const ptr, size_t size) {
+#ifdef __GLIBC__
+    /* A glibc chunk is its usable size plus one size field header */
+    return malloc_usable_size(ptr) + sizeof(size_t);
+#else
+    return size;
+#endif
+}
+
+void scl_memory_alloc(set_memory_stats_t * const stats, void * const ptr, size_t size) {
+    stats->live_bytes += size;
+    stats->allocated_bytes += scl_allocated_size(ptr, size);
+    ++stats->allocations;
+
+    if (stats->peak_bytes < stats->live_bytes) {
+        stats->peak_bytes = stats->live_bytes;
+    }
+}
+
+void scl_memory_free(set_memory_stats_t * const stats, void * const ptr, size_t size) {
+    stats->live_bytes -= size;
+    stats->allocated_bytes -= scl_allocated_size(ptr, size);
+    ++stats->frees;
+}
+
+/* Adds the accounting of a part (a shard) to the one of the whole, the peaks add up to an upper bound */
+void scl_memory_merge(set_memory_stats_t * const dest, const set_memory_stats_t * const src) {
+    dest->live_bytes += src->live_bytes;
+    dest->allocated_bytes += src->allocated_bytes;
+    dest->peak_bytes += src->peak_bytes;
+    dest->allocations += src->allocations;
+    dest->frees += src->frees;
+    dest->overhead_bytes += src->overhead_bytes;
+    dest->keys += src->keys;
+}
+
+size_t get_set_ops_count(void) {
+    return sizeof(set_engines) / sizeof(*set_engines);
+}
+
+const set_ops_t* get_set_ops_at(size_t index) {
+    if (index >= get_set_ops_count()) {
+        return NULL;
+    }
+
+    return set_engines[index];
+}
+
+const set_ops_t* get_set_ops(const char * const name) {
+    if (NULL == name) {
+        return NULL;
+    }
+
+    for (size_t iter = 0; iter < get_set_ops_count(); ++iter) {
+        if (0 == strcmp(set_engines[iter]->name, name)) {
+            return set_engines[iter];
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,836 @@
+/**
+ * @file cuckoo_hash.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#include "./include/cuckoo_hash.h"
+#include "./include/int_writer.h"
+
+#define DEFAULT_CUCKOO_CAPACITY 50
+#define DEFAULT_CUCKOO_LOAD_FACTOR 0.9
+#define DEFAULT_CUCKOO_CAPACITY_RATIO 2
+
+/**
+ * @brief Maximum number of times the table grows for one insert, when
+ * the keys still do not fit the table gives up instead of growing forever
+ * 
+ */
+#define CUCKOO_MAX_REHASH_ATTEMPTS 4
+
+/**
+ * @brief Maximum number of buckets visited by the breadth first
+ * search of a free slot (1 + 8 + 64 + 512), this bounds the insertion
+ * path to a depth of 3
+ * 
+ */
+#define CUCKOO_MAX_BFS_NODES 585
+
+/**
+ * @brief Breadth first search node, remembers the bucket reached and
+ * the slot of the parent bucket whose key would be moved in here
+ * 
+ */
+typedef struct cuckoo_hash_bfs_node_s {
+    size_t bucket_index;                                        /* Bucket reached by the search */
+    int32_t parent;                                             /* Index of the parent node, -1 for the two start buckets */
+    int32_t parent_slot;                                        /* Slot of the parent bucket that leads to this bucket */
+} cuckoo_hash_bfs_node_t;
+
+static size_t cuckoo_hash_mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+
+    return (size_t)hash;
+}
+
+static size_t cuckoo_hash_first_bucket(const cuckoo_hash_t * const __restrict__ ht, int32_t key) {
+    return cuckoo_hash_mix(ht->hash(key)) & ht->bucket_mask;
+}
+
+/*
+ * The second bucket mixes the key itself, not the user hash, so keys that share
+ * a user hash value (a weak or constant hash) still spread over the table
+ */
+static size_t cuckoo_hash_second_bucket(const cuckoo_hash_t * const __restrict__ ht, int32_t key, size_t first_bucket) {
+    size_t second_bucket = cuckoo_hash_mix((uint64_t)(uint32_t)key ^ UINT64_C(0x9e3779b97f4a7c15)) & ht->bucket_mask;
+
+    if (second_bucket == first_bucket) {
+        second_bucket = (first_bucket + 1) & ht->bucket_mask;
+    }
+
+    return second_bucket;
+}
+
+static size_t cuckoo_hash_alternate_bucket(const cuckoo_hash_t * const __restrict__ ht, int32_t key, size_t bucket_index) {
+    size_t first_bucket = cuckoo_hash_first_bucket(ht, key);
+
+    if (first_bucket != bucket_index) {
+        return first_bucket;
+    }
+
+    return cuckoo_hash_second_bucket(ht, key, first_bucket);
+}
+
+static cuckoo_hash_bucket_t* create_cuckoo_hash_buckets(size_t bucket_count) {
+    cuckoo_hash_bucket_t *buckets = aligned_alloc(CUCKOO_CACHE_LINE, sizeof(*buckets) * bucket_count);
+
+    if (NULL != buckets) {
+        memset(buckets, 0, sizeof(*buckets) * bucket_count);
+    }
+
+    return buckets;
+}
+
+cuckoo_hash_t* create_cuckoo_hash(size_t init_capacity, hash_func hash) {
+    if (NULL == hash) {
+        errno = EINVAL;
+        perror("hash function undefined in cuckoo_hash");
+        return NULL;
+    }
+
+    if (10 >= init_capacity) {
+        init_capacity = DEFAULT_CUCKOO_CAPACITY;
+    }
+
+    size_t bucket_count = 1;
+
+    while (bucket_count * CUCKOO_BUCKET_SLOTS * DEFAULT_CUCKOO_LOAD_FACTOR < init_capacity) {
+        bucket_count *= 2;
+    }
+
+    cuckoo_hash_t *new_hash_table = malloc(sizeof(*new_hash_table));
+
+    if (NULL != new_hash_table) {
+        memset(&new_hash_table->memory, 0, sizeof(new_hash_table->memory));
+        scl_memory_alloc(&new_hash_table->memory, new_hash_table, sizeof(*new_hash_table));
+
+        new_hash_table->hash = hash;
+        new_hash_table->bucket_mask = bucket_count - 1;
+        new_hash_table->size = 0;
+        new_hash_table->stash_size = 0;
+        new_hash_table->filter = NULL;
+
+        new_hash_table->buckets = create_cuckoo_hash_buckets(bucket_count);
+
+        if (NULL == new_hash_table->buckets) {
+            free(new_hash_table);
+            new_hash_table = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for buckets of cuckoo hash");
+        } else {
+            scl_memory_alloc(&new_hash_table->memory, new_hash_table->buckets, sizeof(*new_hash_table->buckets) * bucket_count);
+        }
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for cuckoo hash allocation");
+    }
+
+    return new_hash_table;
+}
+
+error_t free_cuckoo_hash(cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL != ht) {
+        free(ht->buckets);
+        ht->buckets = NULL;
+
+        free(ht);
+
+        return SCL_OK;
+    }
+
+    return SCL_NULL_CUCKOO_HASH;
+}
+
+static uint32_t* cuckoo_hash_find_count(const cuckoo_hash_t * const __restrict__ ht, int32_t key) {
+    size_t first_bucket = cuckoo_hash_first_bucket(ht, key);
+    cuckoo_hash_bucket_t *bucket = &ht->buckets[first_bucket];
+
+    for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+        if ((0 != bucket->counts[slot]) && (key == bucket->keys[slot])) {
+            return &bucket->counts[slot];
+        }
+    }
+
+    bucket = &ht->buckets[cuckoo_hash_second_bucket(ht, key, first_bucket)];
+
+    for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+        if ((0 != bucket->counts[slot]) && (key == bucket->keys[slot])) {
+            return &bucket->counts[slot];
+        }
+    }
+
+    for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+        if (key == ht->stash_keys[iter]) {
+            return (uint32_t *)&ht->stash_counts[iter];
+        }
+    }
+
+    return NULL;
+}
+
+static int32_t cuckoo_hash_free_slot(const cuckoo_hash_bucket_t * const __restrict__ bucket) {
+    for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+        if (0 == bucket->counts[slot]) {
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+static uint8_t cuckoo_hash_bfs_path_contains(const cuckoo_hash_bfs_node_t * const __restrict__ queue, int32_t node, size_t bucket_index) {
+    while (-1 != node) {
+        if (queue[node].bucket_index == bucket_index) {
+            return 1;
+        }
+
+        node = queue[node].parent;
+    }
+
+    return 0;
+}
+
+static uint8_t cuckoo_hash_place_key(cuckoo_hash_t * const __restrict__ ht, int32_t key, uint32_t count) {
+    size_t first_bucket = cuckoo_hash_first_bucket(ht, key);
+    size_t second_bucket = cuckoo_hash_second_bucket(ht, key, first_bucket);
+
+    cuckoo_hash_bfs_node_t queue[CUCKOO_MAX_BFS_NODES];
+
+    queue[0].bucket_index = first_bucket;
+    queue[0].parent = queue[0].parent_slot = -1;
+    queue[1].bucket_index = second_bucket;
+    queue[1].parent = queue[1].parent_slot = -1;
+
+    int32_t queue_size = 2;
+
+    for (int32_t node = 0; node < queue_size; ++node) {
+        cuckoo_hash_bucket_t *bucket = &ht->buckets[queue[node].bucket_index];
+        int32_t free_slot = cuckoo_hash_free_slot(bucket);
+
+        if (-1 == free_slot) {
+            for (int32_t slot = 0; (slot < CUCKOO_BUCKET_SLOTS) && (queue_size < CUCKOO_MAX_BFS_NODES); ++slot) {
+                size_t next_bucket = cuckoo_hash_alternate_bucket(ht, bucket->keys[slot], queue[node].bucket_index);
+
+                if (0 == cuckoo_hash_bfs_path_contains(queue, node, next_bucket)) {
+                    queue[queue_size].bucket_index = next_bucket;
+                    queue[queue_size].parent = node;
+                    queue[queue_size].parent_slot = slot;
+                    ++queue_size;
+                }
+            }
+
+            continue;
+        }
+
+        /* Walk the path back to a start bucket, every key moves into the slot freed below it */
+        while (-1 != queue[node].parent) {
+            cuckoo_hash_bucket_t *parent_bucket = &ht->buckets[queue[queue[node].parent].bucket_index];
+            int32_t parent_slot = queue[node].parent_slot;
+
+            bucket->keys[free_slot] = parent_bucket->keys[parent_slot];
+            bucket->counts[free_slot] = parent_bucket->counts[parent_slot];
+
+            bucket = parent_bucket;
+            free_slot = parent_slot;
+            node = queue[node].parent;
+        }
+
+        bucket->keys[free_slot] = key;
+        bucket->counts[free_slot] = count;
+
+        return 1;
+    }
+
+    if (CUCKOO_STASH_SIZE > ht->stash_size) {
+        ht->stash_keys[ht->stash_size] = key;
+        ht->stash_counts[ht->stash_size] = count;
+        ++(ht->stash_size);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static error_t cuckoo_hash_rehash(cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->hash) {
+        return SCL_NULL_HASH_FUNCTION;
+    }
+
+    cuckoo_hash_bucket_t *old_buckets = ht->buckets;
+    size_t old_bucket_count = ht->bucket_mask + 1;
+    size_t old_stash_size = ht->stash_size;
+    int32_t old_stash_keys[CUCKOO_STASH_SIZE];
+    uint32_t old_stash_counts[CUCKOO_STASH_SIZE];
+
+    memcpy(old_stash_keys, ht->stash_keys, sizeof(old_stash_keys));
+    memcpy(old_stash_counts, ht->stash_counts, sizeof(old_stash_counts));
+
+    size_t new_bucket_count = old_bucket_count;
+    uint8_t placed_all = 0;
+
+    for (int32_t attempt = 0; (attempt < CUCKOO_MAX_REHASH_ATTEMPTS) && (0 == placed_all); ++attempt) {
+        new_bucket_count *= DEFAULT_CUCKOO_CAPACITY_RATIO;
+
+        cuckoo_hash_bucket_t *new_buckets = create_cuckoo_hash_buckets(new_bucket_count);
+
+        if (NULL == new_buckets) {
+            errno = ENOMEM;
+            perror("Not enough memory for buckets of cuckoo hash");
+
+            break;
+        }
+
+        scl_memory_alloc(&ht->memory, new_buckets, sizeof(*new_buckets) * new_bucket_count);
+
+        ht->buckets = new_buckets;
+        ht->bucket_mask = new_bucket_count - 1;
+        ht->stash_size = 0;
+        placed_all = 1;
+
+        for (size_t iter = 0; (iter < old_bucket_count) && (1 == placed_all); ++iter) {
+            for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+                if ((0 != old_buckets[iter].counts[slot]) && (0 == cuckoo_hash_place_key(ht, old_buckets[iter].keys[slot], old_buckets[iter].counts[slot]))) {
+                    placed_all = 0;
+                    break;
+                }
+            }
+        }
+
+        for (size_t iter = 0; (iter < old_stash_size) && (1 == placed_all); ++iter) {
+            placed_all = cuckoo_hash_place_key(ht, old_stash_keys[iter], old_stash_counts[iter]);
+        }
+
+        if (0 == placed_all) {
+            scl_memory_free(&ht->memory, new_buckets, sizeof(*new_buckets) * new_bucket_count);
+            free(new_buckets);
+        }
+    }
+
+    /* The table is left as it was before the rehash */
+    if (0 == placed_all) {
+        ht->buckets = old_buckets;
+        ht->bucket_mask = old_bucket_count - 1;
+        ht->stash_size = old_stash_size;
+        memcpy(ht->stash_keys, old_stash_keys, sizeof(old_stash_keys));
+        memcpy(ht->stash_counts, old_stash_counts, sizeof(old_stash_counts));
+
+        return SCL_REHASHING_FAILED;
+    }
+
+    scl_memory_free(&ht->memory, old_buckets, sizeof(*old_buckets) * old_bucket_count);
+    free(old_buckets);
+    old_buckets = NULL;
+
+    return SCL_OK;
+}
+
+error_t cuckoo_hash_insert(cuckoo_hash_t * const __restrict__ ht, int32_t key) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    uint32_t *key_count = cuckoo_hash_find_count(ht, key);
+
+    if (NULL != key_count) {
+        ++(*key_count);
+        return SCL_OK;
+    }
+
+    if ((1.0 * (ht->size + 1)) / ((ht->bucket_mask + 1) * CUCKOO_BUCKET_SLOTS) > DEFAULT_CUCKOO_LOAD_FACTOR) {
+        error_t err = cuckoo_hash_rehash(ht);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    for (int32_t attempt = 0; 0 == cuckoo_hash_place_key(ht, key, 1); ++attempt) {
+        /* Keys that collide on both buckets and fill the stash are not separated by a larger table */
+        if (CUCKOO_MAX_REHASH_ATTEMPTS == attempt) {
+            return SCL_REHASHING_FAILED;
+        }
+
+        error_t err = cuckoo_hash_rehash(ht);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+    }
+
+    if (NULL != ht->filter) {
+        membership_filter_insert(ht->filter, key);
+    }
+
+    ++(ht->size);
+
+    return SCL_OK;
+}
+
+static void cuckoo_hash_drain_stash(cuckoo_hash_t * const __restrict__ ht) {
+    size_t iter = 0;
+
+    while (iter < ht->stash_size) {
+        int32_t key = ht->stash_keys[iter];
+        size_t first_bucket = cuckoo_hash_first_bucket(ht, key);
+        cuckoo_hash_bucket_t *bucket = &ht->buckets[first_bucket];
+        int32_t free_slot = cuckoo_hash_free_slot(bucket);
+
+        if (-1 == free_slot) {
+            bucket = &ht->buckets[cuckoo_hash_second_bucket(ht, key, first_bucket)];
+            free_slot = cuckoo_hash_free_slot(bucket);
+        }
+
+        if (-1 == free_slot) {
+            ++iter;
+            continue;
+        }
+
+        bucket->keys[free_slot] = key;
+        bucket->counts[free_slot] = ht->stash_counts[iter];
+
+        --(ht->stash_size);
+        ht->stash_keys[iter] = ht->stash_keys[ht->stash_size];
+        ht->stash_counts[iter] = ht->stash_counts[ht->stash_size];
+    }
+}
+
+error_t cuckoo_hash_delete(cuckoo_hash_t * const __restrict__ ht, int32_t key) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    uint32_t *key_count = cuckoo_hash_find_count(ht, key);
+
+    if (NULL == key_count) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    if ((key_count >= ht->stash_counts) && (key_count < ht->stash_counts + CUCKOO_STASH_SIZE)) {
+        size_t stash_index = (size_t)(key_count - ht->stash_counts);
+
+        --(ht->stash_size);
+        ht->stash_keys[stash_index] = ht->stash_keys[ht->stash_size];
+        ht->stash_counts[stash_index] = ht->stash_counts[ht->stash_size];
+    } else {
+        *key_count = 0;
+
+        if (0 != ht->stash_size) {
+            cuckoo_hash_drain_stash(ht);
+        }
+    }
+
+    if (NULL != ht->filter) {
+        membership_filter_delete(ht->filter, key);
+    }
+
+    --(ht->size);
+
+    return SCL_OK;
+}
+
+error_t cuckoo_hash_modify(cuckoo_hash_t * const __restrict__ ht, int32_t old_key, int32_t new_key) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (NULL == ht->hash) {
+        return SCL_NULL_HASH_FUNCTION;
+    }
+
+    error_t err = cuckoo_hash_delete(ht, old_key);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    return cuckoo_hash_insert(ht, new_key);
+}
+
+uint8_t cuckoo_hash_includes(const cuckoo_hash_t * const __restrict__ ht, int32_t key) {
+    if ((NULL == ht) || (NULL == ht->buckets)) {
+        return 0;
+    }
+
+    if (NULL != ht->filter) {
+        if (0 == membership_filter_lookup(ht->filter, key)) {
+            return 0;
+        }
+
+        uint8_t found = (NULL != cuckoo_hash_find_count(ht, key));
+
+        membership_filter_confirm(ht->filter, found);
+
+        return found;
+    }
+
+    return (NULL != cuckoo_hash_find_count(ht, key));
+}
+
+error_t cuckoo_hash_attach_filter(cuckoo_hash_t * const __restrict__ ht, membership_filter_t * const filter) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    ht->filter = filter;
+
+    if (NULL != filter) {
+        error_t err = membership_filter_clear(filter);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        for (size_t iter = 0; iter <= ht->bucket_mask; ++iter) {
+            for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+                if (0 != ht->buckets[iter].counts[slot]) {
+                    membership_filter_insert(filter, ht->buckets[iter].keys[slot]);
+                }
+            }
+        }
+
+        for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+            membership_filter_insert(filter, ht->stash_keys[iter]);
+        }
+    }
+
+    return SCL_OK;
+}
+
+uint8_t is_cuckoo_hash_empty(const cuckoo_hash_t * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+size_t get_cuckoo_hash_size(const cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->size;
+}
+
+size_t get_cuckoo_hash_capacity(const cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return (ht->bucket_mask + 1) * CUCKOO_BUCKET_SLOTS;
+}
+
+error_t cuckoo_hash_memory_stats(const cuckoo_hash_t * const __restrict__ ht, set_memory_stats_t * const stats) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    *stats = ht->memory;
+    stats->keys = ht->size;
+
+    /* The header (stash included) and the empty slots of the buckets */
+    size_t slot_bytes = sizeof(*ht->buckets) / CUCKOO_BUCKET_SLOTS;
+    size_t used_slots = ht->size - ht->stash_size;
+    stats->overhead_bytes = sizeof(*ht) + ((ht->bucket_mask + 1) * CUCKOO_BUCKET_SLOTS - used_slots) * slot_bytes;
+
+    return SCL_OK;
+}
+
+int32_t cuckoo_hash_get_max(const cuckoo_hash_t * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->size)) {
+        return INT32_MIN;
+    }
+
+    int32_t max_key = INT32_MIN;
+
+    for (size_t iter = 0; iter <= ht->bucket_mask; ++iter) {
+        for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+            if ((0 != ht->buckets[iter].counts[slot]) && (ht->buckets[iter].keys[slot] > max_key)) {
+                max_key = ht->buckets[iter].keys[slot];
+            }
+        }
+    }
+
+    for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+        if (ht->stash_keys[iter] > max_key) {
+            max_key = ht->stash_keys[iter];
+        }
+    }
+
+    return max_key;
+}
+
+int32_t cuckoo_hash_get_min(const cuckoo_hash_t * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->size)) {
+        return INT32_MAX;
+    }
+
+    int32_t min_key = INT32_MAX;
+
+    for (size_t iter = 0; iter <= ht->bucket_mask; ++iter) {
+        for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+            if ((0 != ht->buckets[iter].counts[slot]) && (ht->buckets[iter].keys[slot] < min_key)) {
+                min_key = ht->buckets[iter].keys[slot];
+            }
+        }
+    }
+
+    for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+        if (ht->stash_keys[iter] < min_key) {
+            min_key = ht->stash_keys[iter];
+        }
+    }
+
+    return min_key;
+}
+
+error_t cuckoo_hash_delete_max(cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    return cuckoo_hash_delete(ht, cuckoo_hash_get_max(ht));
+}
+
+error_t cuckoo_hash_delete_min(cuckoo_hash_t * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    return cuckoo_hash_delete(ht, cuckoo_hash_get_min(ht));
+}
+
+error_t cuckoo_hash_traverse_inorder(const cuckoo_hash_t * const __restrict__ ht, FILE *fout) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    int_writer_t *writer = create_int_writer_stream(fout, INT_WRITER_BUFFER_SIZE);
+
+    if (NULL == writer) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    for (size_t iter = 0; iter <= ht->bucket_mask; ++iter) {
+        for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+            if (0 != ht->buckets[iter].counts[slot]) {
+                int_writer_put_int(writer, ht->buckets[iter].keys[slot]);
+            }
+        }
+    }
+
+    for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+        int_writer_put_int(writer, ht->stash_keys[iter]);
+    }
+
+    int_writer_put_bytes(writer, "\n", 1);
+
+    return free_int_writer(writer);
+}
+
+error_t cuckoo_hash_traverse_visit(const cuckoo_hash_t * const __restrict__ ht, set_visit_func visit, void *context) {
+    if (NULL == ht) {
+        return SCL_NULL_CUCKOO_HASH;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (NULL == visit) {
+        return SCL_INVALID_INPUT;
+    }
+
+    for (size_t iter = 0; iter <= ht->bucket_mask; ++iter) {
+        for (int32_t slot = 0; slot < CUCKOO_BUCKET_SLOTS; ++slot) {
+            if (0 != ht->buckets[iter].counts[slot]) {
+                visit(ht->buckets[iter].keys[slot], context);
+            }
+        }
+    }
+
+    for (size_t iter = 0; iter < ht->stash_size; ++iter) {
+        visit(ht->stash_keys[iter], context);
+    }
+
+    return SCL_OK;
+}
+
+static void* cuckoo_hash_set_create(size_t capacity_hint, hash_func hash) {
+    return create_cuckoo_hash(capacity_hint, (NULL != hash) ? hash : scl_identity_hash);
+}
+
+static error_t cuckoo_hash_set_free(void * const set) {
+    return free_cuckoo_hash(set);
+}
+
+static error_t cuckoo_hash_set_insert(void * const set, int32_t key) {
+    return cuckoo_hash_insert(set, key);
+}
+
+static error_t cuckoo_hash_set_delete(void * const set, int32_t key) {
+    return cuckoo_hash_delete(set, key);
+}
+
+static error_t cuckoo_hash_set_modify(void * const set, int32_t old_key, int32_t new_key) {
+    return cuckoo_hash_modify(set, old_key, new_key);
+}
+
+static uint8_t cuckoo_hash_set_includes(const void * const set, int32_t key) {
+    return cuckoo_hash_includes(set, key);
+}
+
+static int32_t cuckoo_hash_set_min(const void * const set) {
+    return cuckoo_hash_get_min(set);
+}
+
+static int32_t cuckoo_hash_set_max(const void * const set) {
+    return cuckoo_hash_get_max(set);
+}
+
+static error_t cuckoo_hash_set_delete_min(void * const set) {
+    return cuckoo_hash_delete_min(set);
+}
+
+static error_t cuckoo_hash_set_delete_max(void * const set) {
+    return cuckoo_hash_delete_max(set);
+}
+
+static error_t cuckoo_hash_set_traverse(const void * const set, FILE *fout) {
+    return cuckoo_hash_traverse_inorder(set, fout);
+}
+
+static error_t cuckoo_hash_set_visit(const void * const set, set_visit_func visit, void *context) {
+    return cuckoo_hash_traverse_visit(set, visit, context);
+}
+
+static size_t cuckoo_hash_set_size(const void * const set) {
+    return get_cuckoo_hash_size(set);
+}
+
+static error_t cuckoo_hash_set_memory_stats(const void * const set, set_memory_stats_t * const stats) {
+    return cuckoo_hash_memory_stats(set, stats);
+}
+
+static size_t cuckoo_hash_set_insert_batch(void * const set, const int32_t * const keys, size_t length) {
+    cuckoo_hash_t * const ht = set;
+    size_t inserted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        inserted += (SCL_OK == cuckoo_hash_insert(ht, keys[iter]));
+    }
+
+    return inserted;
+}
+
+static size_t cuckoo_hash_set_delete_batch(void * const set, const int32_t * const keys, size_t length) {
+    cuckoo_hash_t * const ht = set;
+    size_t deleted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        deleted += (SCL_OK == cuckoo_hash_delete(ht, keys[iter]));
+    }
+
+    return deleted;
+}
+
+static size_t cuckoo_hash_set_includes_batch(const void * const set, const int32_t * const keys, size_t length, uint8_t * const found) {
+    const cuckoo_hash_t * const ht = set;
+    size_t found_keys = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        found[iter] = cuckoo_hash_includes(ht, keys[iter]);
+        found_keys += found[iter];
+    }
+
+    return found_keys;
+}
+
+const set_ops_t cuckoo_hash_set_ops = {
+    .name = "cuckoo_hash",
+    .create = cuckoo_hash_set_create,
+    .free = cuckoo_hash_set_free,
+    .insert = cuckoo_hash_set_insert,
+    .delete = cuckoo_hash_set_delete,
+    .modify = cuckoo_hash_set_modify,
+    .includes = cuckoo_hash_set_includes,
+    .min = cuckoo_hash_set_min,
+    .max = cuckoo_hash_set_max,
+    .delete_min = cuckoo_hash_set_delete_min,
+    .delete_max = cuckoo_hash_set_delete_max,
+    .traverse = cuckoo_hash_set_traverse,
+    .visit = cuckoo_hash_set_visit,
+    .size = cuckoo_hash_set_size,
+    .insert_batch = cuckoo_hash_set_insert_batch,
+    .delete_batch = cuckoo_hash_set_delete_batch,
+    .includes_batch = cuckoo_hash_set_includes_batch,
+    .memory_stats = cuckoo_hash_set_memory_stats,
+};
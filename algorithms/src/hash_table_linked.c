@@ -23,10 +23,13 @@
  */
 
 #include "./include/hash_table_linked.h"
+#include "./include/int_writer.h"
 
 #define DEFAULT_HASH_CAPACITY 50
 #define DEFAULT_HASH_LOAD_FACTOR 0.75
 #define DEFAULT_HASH_CAPACITY_RATIO 2
+#define HASH_BATCH_GROUP 16
+#define HASH_BATCH_CHUNK 1024
 
 
 hash_table_linked_t* create_hash_table(size_t init_capacity, hash_func hash) {
@@ -43,13 +46,19 @@ hash_table_linked_t* create_hash_table(size_t init_capacity, hash_func hash) {
     hash_table_linked_t *new_hash_table = malloc(sizeof(*new_hash_table));
 
     if (NULL != new_hash_table) {
+        memset(&new_hash_table->memory, 0, sizeof(new_hash_table->memory));
+        scl_memory_alloc(&new_hash_table->memory, new_hash_table, sizeof(*new_hash_table));
+
         new_hash_table->hash = hash;
         new_hash_table->capacity = init_capacity;
         new_hash_table->size = 0;
+        new_hash_table->filter = NULL;
 
         new_hash_table->nil = malloc(sizeof(*new_hash_table->nil));
 
         if (NULL != new_hash_table->nil) {
+            scl_memory_alloc(&new_hash_table->memory, new_hash_table->nil, sizeof(*new_hash_table->nil));
+
             new_hash_table->nil->key = INT32_MIN;
             new_hash_table->nil->color = HASH_BLACK;
             new_hash_table->nil->count = 1;
@@ -59,6 +68,8 @@ hash_table_linked_t* create_hash_table(size_t init_capacity, hash_func hash) {
             new_hash_table->buckets = malloc(sizeof(*new_hash_table->buckets) * init_capacity);
 
             if (NULL != new_hash_table->buckets) {
+                scl_memory_alloc(&new_hash_table->memory, new_hash_table->buckets, sizeof(*new_hash_table->buckets) * init_capacity);
+
                 for (size_t iter = 0; iter < init_capacity; ++iter) {
                     new_hash_table->buckets[iter] = new_hash_table->nil;
                 }
@@ -85,9 +96,10 @@ hash_table_linked_t* create_hash_table(size_t init_capacity, hash_func hash) {
     return new_hash_table;
 }
 
-static void free_hash_table_node(const hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t ** const __restrict__ free_node) {
+static void free_hash_table_node(hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t ** const __restrict__ free_node) {
     if ((NULL != ht) && (NULL != free_node) && (ht->nil != *free_node)) {
         if (ht->nil != *free_node) {
+            scl_memory_free(&ht->memory, *free_node, sizeof(**free_node));
             free(*free_node);
         }
 
@@ -95,7 +107,7 @@ static void free_hash_table_node(const hash_table_linked_t * const __restrict__
     }
 }
 
-static void free_hash_table_helper(const hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t ** const __restrict__ bucket) {
+static void free_hash_table_helper(hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t ** const __restrict__ bucket) {
     if ((NULL == bucket) || (ht->nil == *bucket)) {
         return;
     }
@@ -127,10 +139,11 @@ error_t free_hash_table(hash_table_linked_t * const __restrict__ ht) {
     return SCL_NULL_HASH_TABLE;
 }
 
-static hash_table_linked_node_t* create_hash_table_node(const hash_table_linked_t * const __restrict__ ht, int32_t key) {
+static hash_table_linked_node_t* create_hash_table_node(hash_table_linked_t * const __restrict__ ht, int32_t key) {
     hash_table_linked_node_t *new_node = malloc(sizeof(*new_node));
 
     if (NULL != new_node) {
+        scl_memory_alloc(&ht->memory, new_node, sizeof(*new_node));
         new_node->left = new_node->right = ht->nil;
         new_node->parent = ht->nil;
         new_node->count = 1;
@@ -293,48 +306,40 @@ static error_t hash_table_insert_fix_node_up(const hash_table_linked_t * const _
 
 static error_t hash_table_rehash(hash_table_linked_t * const __restrict__ ht);
 
-error_t hash_table_insert(hash_table_linked_t * const __restrict__ ht, int32_t key) {
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
-
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
-    }
-
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-
+static hash_table_linked_node_t* hash_table_insert_position(const hash_table_linked_t * const __restrict__ ht, size_t bucket_index, int32_t key, hash_table_linked_node_t ** const parent_node) {
     hash_table_linked_node_t *iterator = ht->buckets[bucket_index];
-    hash_table_linked_node_t *parent_iterator = ht->nil;
+
+    *parent_node = ht->nil;
 
     while (ht->nil != iterator) {
-        parent_iterator = iterator;
+        *parent_node = iterator;
 
         if (iterator->key > key) {
             iterator = iterator->left;
         } else if (iterator->key < key) {
             iterator = iterator->right;
         } else {
-            ++(iterator->count);
-            return SCL_OK;
+            return iterator;
         }
     }
 
-    hash_table_linked_node_t *new_node = create_hash_table_node(ht, key);
+    return ht->nil;
+}
 
-    if (ht->nil == new_node) {
-        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+static error_t hash_table_link_node(hash_table_linked_t * const __restrict__ ht, size_t bucket_index, hash_table_linked_node_t * const parent_node, hash_table_linked_node_t * const new_node) {
+    if (NULL != ht->filter) {
+        membership_filter_insert(ht->filter, new_node->key);
     }
     
     error_t err = SCL_OK;
 
-    if (ht->nil != parent_iterator) {
-        new_node->parent = parent_iterator;
+    if (ht->nil != parent_node) {
+        new_node->parent = parent_node;
 
-        if (parent_iterator->key > new_node->key) {
-            parent_iterator->left = new_node;
+        if (parent_node->key > new_node->key) {
+            parent_node->left = new_node;
         } else {
-            parent_iterator->right = new_node;
+            parent_node->right = new_node;
         }
 
         err = hash_table_insert_fix_node_up(ht, bucket_index, new_node);
@@ -345,6 +350,36 @@ error_t hash_table_insert(hash_table_linked_t * const __restrict__ ht, int32_t k
 
     ++(ht->size);
 
+    return err;
+}
+
+error_t hash_table_insert(hash_table_linked_t * const __restrict__ ht, int32_t key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    size_t bucket_index = ht->hash(key) % ht->capacity;
+
+    hash_table_linked_node_t *parent_iterator = ht->nil;
+    hash_table_linked_node_t *iterator = hash_table_insert_position(ht, bucket_index, key, &parent_iterator);
+
+    if (ht->nil != iterator) {
+        ++(iterator->count);
+        return SCL_OK;
+    }
+
+    hash_table_linked_node_t *new_node = create_hash_table_node(ht, key);
+
+    if (ht->nil == new_node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    error_t err = hash_table_link_node(ht, bucket_index, parent_iterator, new_node);
+
     if (1 == hash_table_need_to_rehash(ht)) {
         return hash_table_rehash(ht);
     }
@@ -390,9 +425,15 @@ static error_t hash_table_rehash(hash_table_linked_t * const __restrict__ ht) {
         return SCL_REHASHING_FAILED;
     }
 
+    scl_memory_alloc(&ht->memory, new_buckets, sizeof(*new_buckets) * ht->capacity);
+
     hash_table_linked_node_t **old_buckets = ht->buckets;
     ht->buckets = new_buckets;
 
+    /* Keys only move between buckets, the filter must not count them twice */
+    membership_filter_t *filter = ht->filter;
+    ht->filter = NULL;
+
     for (size_t iter = 0; iter < ht->capacity; ++iter) {
         new_buckets[iter] = ht->nil;
     }
@@ -406,9 +447,12 @@ static error_t hash_table_rehash(hash_table_linked_t * const __restrict__ ht) {
         }
     }
 
+    scl_memory_free(&ht->memory, old_buckets, sizeof(*old_buckets) * old_capacity);
     free(old_buckets);
     old_buckets = NULL;
 
+    ht->filter = filter;
+
     return SCL_OK;
 }
 
@@ -434,34 +478,155 @@ static hash_table_linked_node_t* hash_table_find_node(const hash_table_linked_t
     return ht->nil;
 }
 
-error_t hash_table_modify(hash_table_linked_t * const __restrict__ ht, int32_t old_key, int32_t new_key) {
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
+uint8_t hash_table_includes(const hash_table_linked_t * const __restrict__ ht, int32_t key) {
+    if ((NULL != ht) && (NULL != ht->filter)) {
+        if (0 == membership_filter_lookup(ht->filter, key)) {
+            return 0;
+        }
 
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
+        uint8_t found = (ht->nil != hash_table_find_node(ht, key));
+
+        membership_filter_confirm(ht->filter, found);
+
+        return found;
     }
 
-    if (NULL == ht->hash) {
-        return SCL_NULL_HASH_FUNCTION;
+    if (ht->nil == hash_table_find_node(ht, key)) {
+        return 0;
     }
 
-    error_t err = hash_table_delete(ht, old_key);
+    return 1;
+}
 
-    if (SCL_OK != err) {
-        return err;
+/**
+ * @brief State of one lookup in flight inside hash_table_includes_batch
+ * 
+ */
+typedef struct hash_table_batch_lookup_s {
+    const hash_table_linked_node_t *node;                       /* Next node to compare, or NULL before the bucket slot is read */
+    const hash_table_linked_node_t * const *slot;               /* Bucket slot of the key, prefetched in the previous round */
+    size_t index;                                               /* Index of the key in the batch */
+    int32_t key;                                                /* Key that is looked up */
+} hash_table_batch_lookup_t;
+
+static void hash_table_batch_start(const hash_table_linked_t * const __restrict__ ht, hash_table_batch_lookup_t * const __restrict__ lookup, const int32_t * const keys, size_t index) {
+    lookup->index = index;
+    lookup->key = keys[index];
+    lookup->node = NULL;
+    lookup->slot = (const hash_table_linked_node_t * const *)&ht->buckets[ht->hash(lookup->key) % ht->capacity];
+
+    __builtin_prefetch(lookup->slot, 0, 0);
+}
+
+static size_t hash_table_batch_next_key(const hash_table_linked_t * const __restrict__ ht, const int32_t * const keys, size_t length, size_t next_key) {
+    /* Keys ruled out by the filter never enter the group */
+    while ((next_key < length) && (0 == membership_filter_lookup(ht->filter, keys[next_key]))) {
+        ++next_key;
     }
 
-    return hash_table_insert(ht, new_key);
+    return next_key;
 }
 
-uint8_t hash_table_includes(const hash_table_linked_t * const __restrict__ ht, int32_t key) {
-    if (ht->nil == hash_table_find_node(ht, key)) {
+size_t hash_table_includes_batch(const hash_table_linked_t * const __restrict__ ht, const int32_t * const keys, size_t length, uint64_t * const out_bits) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (NULL == keys) || (NULL == out_bits)) {
         return 0;
     }
 
-    return 1;
+    memset(out_bits, 0, sizeof(*out_bits) * ((length + 63) / 64));
+
+    /*
+     * Asynchronous memory access chaining, every lookup in the group advances one
+     * dependent load per round and prefetches the next one, so the cache misses of
+     * HASH_BATCH_GROUP lookups overlap instead of being paid one after the other.
+     * A finished lookup hands its place to the next key of the batch right away.
+     */
+    hash_table_batch_lookup_t group[HASH_BATCH_GROUP];
+    size_t active = 0;
+    size_t next_key = 0;
+    size_t found_keys = 0;
+
+    while ((active < HASH_BATCH_GROUP) && ((next_key = hash_table_batch_next_key(ht, keys, length, next_key)) < length)) {
+        hash_table_batch_start(ht, &group[active++], keys, next_key++);
+    }
+
+    while (0 != active) {
+        for (size_t iter = 0; iter < active; ++iter) {
+            hash_table_batch_lookup_t * const lookup = &group[iter];
+            uint8_t done = 0;
+            uint8_t found = 0;
+
+            if (NULL == lookup->node) {
+                lookup->node = *lookup->slot;
+            } else if (lookup->node->key < lookup->key) {
+                lookup->node = lookup->node->right;
+            } else if (lookup->node->key > lookup->key) {
+                lookup->node = lookup->node->left;
+            } else {
+                done = found = 1;
+            }
+
+            if (ht->nil == lookup->node) {
+                done = 1;
+            }
+
+            if (0 == done) {
+                __builtin_prefetch(lookup->node, 0, 0);
+                continue;
+            }
+
+            membership_filter_confirm(ht->filter, found);
+
+            if (0 != found) {
+                out_bits[lookup->index / 64] |= UINT64_C(1) << (lookup->index % 64);
+                ++found_keys;
+            }
+
+            if ((next_key = hash_table_batch_next_key(ht, keys, length, next_key)) < length) {
+                hash_table_batch_start(ht, lookup, keys, next_key++);
+            } else {
+                group[iter--] = group[--active];
+            }
+        }
+    }
+
+    return found_keys;
+}
+
+static void hash_table_attach_filter_helper(const hash_table_linked_t * const __restrict__ ht, const hash_table_linked_node_t * const __restrict__ bucket, membership_filter_t * const __restrict__ filter) {
+    if (ht->nil == bucket) {
+        return;
+    }
+
+    membership_filter_insert(filter, bucket->key);
+
+    hash_table_attach_filter_helper(ht, bucket->left, filter);
+    hash_table_attach_filter_helper(ht, bucket->right, filter);
+}
+
+error_t hash_table_attach_filter(hash_table_linked_t * const __restrict__ ht, membership_filter_t * const filter) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    ht->filter = filter;
+
+    if (NULL != filter) {
+        error_t err = membership_filter_clear(filter);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        for (size_t iter = 0; iter < ht->capacity; ++iter) {
+            hash_table_attach_filter_helper(ht, ht->buckets[iter], filter);
+        }
+    }
+
+    return SCL_OK;
 }
 
 uint8_t is_hash_table_empty(const hash_table_linked_t * const __restrict__ ht) {
@@ -488,6 +653,24 @@ size_t get_hash_table_capacity(const hash_table_linked_t * const __restrict__ ht
     return ht->capacity;
 }
 
+error_t hash_table_memory_stats(const hash_table_linked_t * const __restrict__ ht, set_memory_stats_t * const stats) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    *stats = ht->memory;
+    stats->keys = ht->size;
+
+    /* The header, the nil sentinel and the bucket array, empty buckets included */
+    stats->overhead_bytes = sizeof(*ht) + sizeof(*ht->nil) + sizeof(*ht->buckets) * ht->capacity;
+
+    return SCL_OK;
+}
+
 static hash_table_linked_node_t* hash_table_root_min_node(const hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t * __restrict__ bucket) {
     if (ht->nil != bucket) {
         while (ht->nil != bucket->left) {
@@ -549,13 +732,13 @@ int32_t hash_table_get_min(const hash_table_linked_t * const __restrict__ ht) {
         return INT32_MAX;
     }
 
-    hash_table_linked_node_t *min_node = hash_table_root_min_node(ht, ht->buckets[0]);
+    hash_table_linked_node_t *min_node = ht->nil;
 
-    for (size_t iter = 1; iter < ht->capacity; ++iter) {
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
         if (ht->nil != ht->buckets[iter]) {
             hash_table_linked_node_t *temp = hash_table_root_min_node(ht, ht->buckets[iter]);
 
-            if (temp->key < min_node->key) {
+            if ((ht->nil == min_node) || (temp->key < min_node->key)) {
                 min_node = temp;
             }
         }
@@ -697,6 +880,7 @@ static error_t hash_table_delete_fix_node_up(const hash_table_linked_t * const _
             if ((HASH_BLACK == brother_node->left->color) && (HASH_BLACK == brother_node->right->color)) {
                 brother_node->color = HASH_RED;
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (HASH_BLACK == brother_node->right->color) {
                     brother_node->left->color = HASH_BLACK;
@@ -730,6 +914,7 @@ static error_t hash_table_delete_fix_node_up(const hash_table_linked_t * const _
             if ((HASH_BLACK == brother_node->right->color) && (HASH_BLACK == brother_node->left->color)) {
                 brother_node->color = HASH_RED;
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (HASH_BLACK == brother_node->left->color) {
                     brother_node->right->color = HASH_BLACK;
@@ -756,22 +941,7 @@ static error_t hash_table_delete_fix_node_up(const hash_table_linked_t * const _
     return SCL_OK;
 }
 
-error_t hash_table_delete(hash_table_linked_t * __restrict__ const ht, int32_t key) {
-    if (NULL == ht) {
-        return SCL_NULL_HASH_TABLE;
-    }
-
-    if (NULL == ht->buckets) {
-        return SCL_NULL_HASH_ROOTS;
-    }
-
-    size_t bucket_index = ht->hash(key) % ht->capacity;
-    hash_table_linked_node_t *delete_node = hash_table_find_node(ht, key);
-
-    if (ht->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
-    }
-
+static error_t hash_table_unlink_node(hash_table_linked_t * __restrict__ const ht, size_t bucket_index, hash_table_linked_node_t * const delete_node) {
     if ((ht->nil != delete_node->left) && (ht->nil != delete_node->right)) {
         hash_table_linked_node_t *delete_succecessor = hash_table_root_min_node(ht, delete_node->right);
                 
@@ -841,25 +1011,148 @@ error_t hash_table_delete(hash_table_linked_t * __restrict__ const ht, int32_t k
 
     hash_table_linked_node_t *parent_delete_node = delete_node->parent;
 
-    free_hash_table_node(ht, &delete_node);
+    if (NULL != ht->filter) {
+        membership_filter_delete(ht->filter, delete_node->key);
+    }
 
     --(ht->size);
 
-    if (0 != need_fixing_tree) {
+    if ((0 != need_fixing_tree) && (ht->nil != parent_delete_node)) {
         return hash_table_delete_fix_node_up(ht, bucket_index, delete_node_child, parent_delete_node);
     }
 
     return SCL_OK;
 }
 
-static void hash_table_bucket_traverse_inorder_helper(const hash_table_linked_t * const __restrict__ ht, const hash_table_linked_node_t * const __restrict__ bucket, FILE *fout) {
+error_t hash_table_delete(hash_table_linked_t * __restrict__ const ht, int32_t key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    size_t bucket_index = ht->hash(key) % ht->capacity;
+    hash_table_linked_node_t *delete_node = hash_table_find_node(ht, key);
+
+    if (ht->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    error_t err = hash_table_unlink_node(ht, bucket_index, delete_node);
+
+    if (SCL_CANNOT_SWAP_DATA != err) {
+        free_hash_table_node(ht, &delete_node);
+    }
+
+    return err;
+}
+
+static uint8_t hash_table_fits_in_place(const hash_table_linked_t * const __restrict__ ht, hash_table_linked_node_t * const __restrict__ node, int32_t key) {
+    const hash_table_linked_node_t *iterator = node;
+
+    if (key < node->key) {
+        if (ht->nil != node->left) {
+            return (hash_table_root_max_node(ht, node->left)->key < key);
+        }
+
+        while ((ht->nil != iterator->parent) && (iterator->parent->left == iterator)) {
+            iterator = iterator->parent;
+        }
+
+        return ((ht->nil == iterator->parent) || (iterator->parent->key < key));
+    }
+
+    if (key > node->key) {
+        if (ht->nil != node->right) {
+            return (hash_table_root_min_node(ht, node->right)->key > key);
+        }
+
+        while ((ht->nil != iterator->parent) && (iterator->parent->right == iterator)) {
+            iterator = iterator->parent;
+        }
+
+        return ((ht->nil == iterator->parent) || (iterator->parent->key > key));
+    }
+
+    return 1;
+}
+
+error_t hash_table_modify(hash_table_linked_t * const __restrict__ ht, int32_t old_key, int32_t new_key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (NULL == ht->hash) {
+        return SCL_NULL_HASH_FUNCTION;
+    }
+
+    size_t old_bucket_index = ht->hash(old_key) % ht->capacity;
+    hash_table_linked_node_t *modify_node = hash_table_find_node(ht, old_key);
+
+    if (ht->nil == modify_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    size_t new_bucket_index = ht->hash(new_key) % ht->capacity;
+
+    /* Both keys share a bucket and the new one keeps the old in-order position */
+    if ((old_bucket_index == new_bucket_index) && (0 != hash_table_fits_in_place(ht, modify_node, new_key))) {
+        if ((NULL != ht->filter) && (old_key != new_key)) {
+            membership_filter_delete(ht->filter, old_key);
+            membership_filter_insert(ht->filter, new_key);
+        }
+
+        modify_node->key = new_key;
+        modify_node->count = 1;
+
+        return SCL_OK;
+    }
+
+    error_t err = hash_table_unlink_node(ht, old_bucket_index, modify_node);
+
+    if (SCL_OK != err) {
+        /* Like a delete, the node is already unlinked unless it could not be swapped */
+        if (SCL_CANNOT_SWAP_DATA != err) {
+            free_hash_table_node(ht, &modify_node);
+        }
+
+        return err;
+    }
+
+    hash_table_linked_node_t *parent_node = ht->nil;
+    hash_table_linked_node_t *existing_node = hash_table_insert_position(ht, new_bucket_index, new_key, &parent_node);
+
+    if (ht->nil != existing_node) {
+        ++(existing_node->count);
+        free_hash_table_node(ht, &modify_node);
+
+        return SCL_OK;
+    }
+
+    /* The table size is unchanged, so the unlinked node is relinked without a rehash check */
+    modify_node->left = modify_node->right = ht->nil;
+    modify_node->parent = ht->nil;
+    modify_node->count = 1;
+    modify_node->color = HASH_RED;
+    modify_node->key = new_key;
+
+    return hash_table_link_node(ht, new_bucket_index, parent_node, modify_node);
+}
+
+static void hash_table_bucket_traverse_inorder_helper(const hash_table_linked_t * const __restrict__ ht, const hash_table_linked_node_t * const __restrict__ bucket, int_writer_t * const __restrict__ writer) {
     if (ht->nil == bucket) {
         return;
     }
 
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->left, fout);
-    fprintf(fout, "%d ", bucket->key);
-    hash_table_bucket_traverse_inorder_helper(ht, bucket->right, fout);
+    hash_table_bucket_traverse_inorder_helper(ht, bucket->left, writer);
+    int_writer_put_int(writer, bucket->key);
+    hash_table_bucket_traverse_inorder_helper(ht, bucket->right, writer);
 }
 
 error_t hash_table_bucket_traverse_inorder(const hash_table_linked_t * const __restrict__ ht, size_t bucket_index, FILE *fout) {
@@ -873,11 +1166,19 @@ error_t hash_table_bucket_traverse_inorder(const hash_table_linked_t * const __r
 
     bucket_index = bucket_index % ht->capacity;
 
-    if (ht->nil != ht->buckets[bucket_index]) {
-        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], fout);
+    if (ht->nil == ht->buckets[bucket_index]) {
+        return SCL_OK;
     }
 
-    return SCL_OK;
+    int_writer_t *writer = create_int_writer_stream(fout, INT_WRITER_BUFFER_SIZE);
+
+    if (NULL == writer) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[bucket_index], writer);
+
+    return free_int_writer(writer);
 }
 
 error_t hash_table_traverse_inorder(const hash_table_linked_t * const __restrict__ ht, FILE *fout) {
@@ -889,15 +1190,164 @@ error_t hash_table_traverse_inorder(const hash_table_linked_t * const __restrict
         return SCL_NULL_HASH_ROOTS;
     }
 
+    int_writer_t *writer = create_int_writer_stream(fout, INT_WRITER_BUFFER_SIZE);
+
+    if (NULL == writer) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    /* One writer for the whole table, instead of one per bucket */
     for (size_t iter = 0; iter < ht->capacity; ++iter) {
-        error_t err = hash_table_bucket_traverse_inorder(ht, iter, fout);
-        
-        if (SCL_OK != err) {
-            return err;
-        }
+        hash_table_bucket_traverse_inorder_helper(ht, ht->buckets[iter], writer);
+    }
+
+    int_writer_put_bytes(writer, "\n", 1);
+
+    return free_int_writer(writer);
+}
+
+static void hash_table_traverse_visit_helper(const hash_table_linked_t * const __restrict__ ht, const hash_table_linked_node_t * const __restrict__ bucket, set_visit_func visit, void *context) {
+    if (ht->nil == bucket) {
+        return;
     }
 
-    fprintf(fout, "\n");
+    hash_table_traverse_visit_helper(ht, bucket->left, visit, context);
+    visit(bucket->key, context);
+    hash_table_traverse_visit_helper(ht, bucket->right, visit, context);
+}
+
+error_t hash_table_traverse_visit(const hash_table_linked_t * const __restrict__ ht, set_visit_func visit, void *context) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (NULL == visit) {
+        return SCL_INVALID_INPUT;
+    }
+
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        hash_table_traverse_visit_helper(ht, ht->buckets[iter], visit, context);
+    }
 
     return SCL_OK;
 }
+
+static void* hash_table_set_create(size_t capacity_hint, hash_func hash) {
+    return create_hash_table(capacity_hint, (NULL != hash) ? hash : scl_identity_hash);
+}
+
+static error_t hash_table_set_free(void * const set) {
+    return free_hash_table(set);
+}
+
+static error_t hash_table_set_insert(void * const set, int32_t key) {
+    return hash_table_insert(set, key);
+}
+
+static error_t hash_table_set_delete(void * const set, int32_t key) {
+    return hash_table_delete(set, key);
+}
+
+static error_t hash_table_set_modify(void * const set, int32_t old_key, int32_t new_key) {
+    return hash_table_modify(set, old_key, new_key);
+}
+
+static uint8_t hash_table_set_includes(const void * const set, int32_t key) {
+    return hash_table_includes(set, key);
+}
+
+static int32_t hash_table_set_min(const void * const set) {
+    return hash_table_get_min(set);
+}
+
+static int32_t hash_table_set_max(const void * const set) {
+    return hash_table_get_max(set);
+}
+
+static error_t hash_table_set_delete_min(void * const set) {
+    return hash_table_delete_min(set);
+}
+
+static error_t hash_table_set_delete_max(void * const set) {
+    return hash_table_delete_max(set);
+}
+
+static error_t hash_table_set_traverse(const void * const set, FILE *fout) {
+    return hash_table_traverse_inorder(set, fout);
+}
+
+static error_t hash_table_set_visit(const void * const set, set_visit_func visit, void *context) {
+    return hash_table_traverse_visit(set, visit, context);
+}
+
+static size_t hash_table_set_size(const void * const set) {
+    return get_hash_table_size(set);
+}
+
+static error_t hash_table_set_memory_stats(const void * const set, set_memory_stats_t * const stats) {
+    return hash_table_memory_stats(set, stats);
+}
+
+static size_t hash_table_set_insert_batch(void * const set, const int32_t * const keys, size_t length) {
+    hash_table_linked_t * const ht = set;
+    size_t inserted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        inserted += (SCL_OK == hash_table_insert(ht, keys[iter]));
+    }
+
+    return inserted;
+}
+
+static size_t hash_table_set_delete_batch(void * const set, const int32_t * const keys, size_t length) {
+    hash_table_linked_t * const ht = set;
+    size_t deleted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        deleted += (SCL_OK == hash_table_delete(ht, keys[iter]));
+    }
+
+    return deleted;
+}
+
+static size_t hash_table_set_includes_batch(const void * const set, const int32_t * const keys, size_t length, uint8_t * const found) {
+    uint64_t found_bits[HASH_BATCH_CHUNK / 64];
+    size_t found_keys = 0;
+
+    for (size_t start = 0; start < length; start += HASH_BATCH_CHUNK) {
+        size_t chunk = (length - start < HASH_BATCH_CHUNK) ? (length - start) : HASH_BATCH_CHUNK;
+
+        found_keys += hash_table_includes_batch(set, keys + start, chunk, found_bits);
+
+        for (size_t iter = 0; iter < chunk; ++iter) {
+            found[start + iter] = (found_bits[iter / 64] >> (iter % 64)) & 1;
+        }
+    }
+
+    return found_keys;
+}
+
+const set_ops_t hash_table_set_ops = {
+    .name = "hash_table",
+    .create = hash_table_set_create,
+    .free = hash_table_set_free,
+    .insert = hash_table_set_insert,
+    .delete = hash_table_set_delete,
+    .modify = hash_table_set_modify,
+    .includes = hash_table_set_includes,
+    .min = hash_table_set_min,
+    .max = hash_table_set_max,
+    .delete_min = hash_table_set_delete_min,
+    .delete_max = hash_table_set_delete_max,
+    .traverse = hash_table_set_traverse,
+    .visit = hash_table_set_visit,
+    .size = hash_table_set_size,
+    .insert_batch = hash_table_set_insert_batch,
+    .delete_batch = hash_table_set_delete_batch,
+    .includes_batch = hash_table_set_includes_batch,
+    .memory_stats = hash_table_set_memory_stats,
+};
@@ -31,6 +31,7 @@
 #include <stdint.h>
 #include <errno.h>
 #include "config.h"
+#include "membership_filter.h"
 
 /**
  * @brief Adelson-Velsky-Landis Tree Node object definition
@@ -53,19 +54,30 @@ typedef struct avl_tree_s {
     avl_tree_node_t *root;                                      /* Pointer to tree root */
     avl_tree_node_t *nil;                                       /* Black hole pointer */
     size_t size;                                                /* Size of the avl tree */
+    membership_filter_t *filter;                                /* Optional filter consulted before lookups, not owned */
+    avl_tree_node_t *finger;                                    /* Last inserted node in finger mode, nil when unknown */
+    avl_tree_node_t *rightmost;                                 /* Largest node in finger mode, nil when unknown */
+    uint8_t finger_mode;                                        /* Inserts start from the finger when non zero */
+    set_memory_stats_t memory;                                  /* Memory accounting of the tree */
 } avl_tree_t;
 
 avl_tree_t*             create_avl                          (void);
 error_t                 free_avl                            (avl_tree_t * const __restrict__ tree);
 
 error_t                 avl_insert                          (avl_tree_t * const __restrict__ tree, int32_t data);
+error_t                 avl_insert_finger_mode              (avl_tree_t * const __restrict__ tree, uint8_t enabled);
 error_t                 avl_delete                          (avl_tree_t * const __restrict__ tree, int32_t data);
 error_t                 avl_modify_data                     (avl_tree_t * const __restrict__ tree, int32_t old_data, int32_t new_data);
 
 uint8_t                 is_avl_empty                        (const avl_tree_t * const __restrict__ tree);
 int32_t                 get_avl_root                        (const avl_tree_t * const __restrict__ tree);
 size_t                  get_avl_size                        (const avl_tree_t * const __restrict__ tree);
+error_t                 avl_memory_stats                    (const avl_tree_t * const __restrict__ tree, set_memory_stats_t * const stats);
 uint8_t                 avl_includes                        (const avl_tree_t * const __restrict__ tree, int32_t data);
+size_t                  avl_includes_sorted_batch           (const avl_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, uint8_t * const found);
+/* For every key the smallest stored key >= it, INT32_MAX when there is none (the same as a stored INT32_MAX), returns the keys with a bound */
+size_t                  avl_lower_bound_batch               (const avl_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, int32_t * const bounds);
+error_t                 avl_attach_filter                   (avl_tree_t * const __restrict__ tree, membership_filter_t * const filter);
 
 int32_t                 avl_max_data                        (const avl_tree_t * const __restrict__ tree);
 int32_t                 avl_min_data                        (const avl_tree_t * const __restrict__ tree);
@@ -73,5 +85,8 @@ error_t                 avl_delete_max                      (avl_tree_t * const
 error_t                 avl_delete_min                      (avl_tree_t * const __restrict__ tree);
 
 error_t                 avl_traverse_inorder                (const avl_tree_t * const __restrict__ tree, FILE *fout);
+error_t                 avl_traverse_visit                  (const avl_tree_t * const __restrict__ tree, set_visit_func visit, void *context);
+
+extern const set_ops_t avl_set_ops;
 
 #endif /* AVLTREE_UTILS_H_ */
@@ -63,6 +63,12 @@ typedef enum error_s {
     SCL_NULL_HASH_ROOTS                         = -39,
     SCL_NULL_HASH_FUNCTION                      = -40,
     SCL_REHASHING_FAILED                        = -41,
+
+    SCL_NULL_CUCKOO_HASH                        = -42,
+    SCL_NULL_MEMBERSHIP_FILTER                  = -43,
+    SCL_NULL_SHARDED_SET                        = -45,
+    SCL_NULL_INT_WRITER                         = -46,
+    SCL_WRITE_FAILED                            = -47,
 } error_t;
 
 /**
@@ -70,7 +76,64 @@ typedef enum error_s {
  * 
  */
 typedef         size_t          (*hash_func)            (int32_t);
+typedef         void            (*set_visit_func)       (int32_t, void *);
+
+/**
+ * @brief Memory accounting of one set object, kept up to date by the set on
+ * every allocation and free. The bytes asked for (live_bytes) are the bytes
+ * the structure really uses, the allocator takes allocated_bytes for them,
+ * the difference is the allocator slack (chunk headers and size rounding)
+ * 
+ */
+typedef struct set_memory_stats_s {
+    size_t live_bytes;                                          /* Bytes asked for by the live allocations */
+    size_t allocated_bytes;                                     /* Bytes the allocator took for the live allocations, headers included */
+    size_t peak_bytes;                                          /* Largest live_bytes since the set was created */
+    size_t allocations;                                         /* Number of allocations since the set was created */
+    size_t frees;                                               /* Number of frees since the set was created */
+    size_t overhead_bytes;                                      /* Live bytes that hold no key, filled by the *_memory_stats functions */
+    size_t keys;                                                /* Distinct keys stored, filled by the *_memory_stats functions */
+} set_memory_stats_t;
+
+/**
+ * @brief Common set interface implemented by every data structure,
+ * the set object is passed as an opaque pointer. The batch functions
+ * are the fast path for tight loops, one indirect call runs a whole
+ * batch of direct (inlinable) calls inside the engine. On an empty set
+ * min returns INT32_MAX and max returns INT32_MIN, a set holding those
+ * keys tells them apart only by its size
+ * 
+ */
+typedef struct set_ops_s {
+    const char *name;                                                                               /* Name used to register and select the engine */
+    void*       (*create)           (size_t capacity_hint, hash_func hash);                         /* Hint and hash are ignored by the trees */
+    error_t     (*free)             (void * const set);
+    error_t     (*insert)           (void * const set, int32_t key);
+    error_t     (*delete)           (void * const set, int32_t key);
+    error_t     (*modify)           (void * const set, int32_t old_key, int32_t new_key);
+    uint8_t     (*includes)         (const void * const set, int32_t key);
+    int32_t     (*min)              (const void * const set);
+    int32_t     (*max)              (const void * const set);
+    error_t     (*delete_min)       (void * const set);
+    error_t     (*delete_max)       (void * const set);
+    error_t     (*traverse)         (const void * const set, FILE *fout);
+    size_t      (*size)             (const void * const set);
+    size_t      (*insert_batch)     (void * const set, const int32_t * const keys, size_t length);  /* Returns the number of successful inserts */
+    size_t      (*delete_batch)     (void * const set, const int32_t * const keys, size_t length);  /* Returns the number of successful deletes */
+    size_t      (*includes_batch)   (const void * const set, const int32_t * const keys, size_t length, uint8_t * const found);  /* Returns the number of found keys */
+    error_t     (*visit)            (const void * const set, set_visit_func visit, void *context);  /* Calls visit once for every distinct key */
+    uint8_t     ordered;                                                                            /* Non zero when visit walks the keys in increasing order */
+    error_t     (*memory_stats)     (const void * const set, set_memory_stats_t * const stats);     /* Fills the memory accounting of the set */
+} set_ops_t;
 
 void                            scl_error_message       (error_t error_message);
+size_t                          scl_identity_hash       (int32_t key);
+void                            scl_memory_alloc        (set_memory_stats_t * const stats, void * const ptr, size_t size);
+void                            scl_memory_free         (set_memory_stats_t * const stats, void * const ptr, size_t size);
+void                            scl_memory_merge        (set_memory_stats_t * const dest, const set_memory_stats_t * const src);
+
+size_t                          get_set_ops_count       (void);
+const set_ops_t*                get_set_ops_at          (size_t index);
+const set_ops_t*                get_set_ops             (const char * const name);
 
 #endif /* _CONFIG_UTILS_H_ */
@@ -0,0 +1,91 @@
+/**
+ * @file cuckoo_hash.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef CUCKOO_HASH_UTILS_H_
+#define CUCKOO_HASH_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "config.h"
+#include "membership_filter.h"
+
+#define CUCKOO_CACHE_LINE                           64
+#define CUCKOO_BUCKET_SLOTS                         8
+#define CUCKOO_STASH_SIZE                           8
+
+/**
+ * @brief Cuckoo Hash Bucket object definition, the 8 keys followed
+ * by their 8 counts fill exactly one cache line, so a lookup touches
+ * at most two cache lines (plus the stash, that lives in the header)
+ * 
+ */
+typedef struct cuckoo_hash_bucket_s {
+    int32_t keys[CUCKOO_BUCKET_SLOTS];                          /* Keys stored in the bucket slots */
+    uint32_t counts[CUCKOO_BUCKET_SLOTS];                       /* Number of inserts of the same key, 0 marks an empty slot */
+} __attribute__((aligned(CUCKOO_CACHE_LINE))) cuckoo_hash_bucket_t;
+
+/**
+ * @brief Cuckoo Hash object definition
+ * 
+ */
+typedef struct cuckoo_hash_s {
+    cuckoo_hash_bucket_t *buckets;                              /* Array of cache line sized buckets */
+    hash_func hash;                                             /* Pointer to a hash function */
+    size_t bucket_mask;                                         /* Number of buckets minus one, buckets are a power of two */
+    size_t size;                                                /* Number of total keys from the cuckoo hash object */
+    size_t stash_size;                                          /* Number of keys that could not be placed in buckets */
+    int32_t stash_keys[CUCKOO_STASH_SIZE];                      /* Keys kept aside after a failed insertion path search */
+    uint32_t stash_counts[CUCKOO_STASH_SIZE];                   /* Number of inserts of the same stashed key */
+    membership_filter_t *filter;                                /* Optional filter consulted before lookups, not owned */
+    set_memory_stats_t memory;                                  /* Memory accounting of the cuckoo hash */
+} cuckoo_hash_t;
+
+cuckoo_hash_t*          create_cuckoo_hash                      (size_t init_capacity, hash_func hash);
+error_t                 free_cuckoo_hash                        (cuckoo_hash_t * const __restrict__ ht);
+
+error_t                 cuckoo_hash_insert                      (cuckoo_hash_t * const __restrict__ ht, int32_t key);
+error_t                 cuckoo_hash_delete                      (cuckoo_hash_t * const __restrict__ ht, int32_t key);
+error_t                 cuckoo_hash_modify                      (cuckoo_hash_t * const __restrict__ ht, int32_t old_key, int32_t new_key);
+uint8_t                 cuckoo_hash_includes                    (const cuckoo_hash_t * const __restrict__ ht, int32_t key);
+error_t                 cuckoo_hash_attach_filter               (cuckoo_hash_t * const __restrict__ ht, membership_filter_t * const filter);
+
+uint8_t                 is_cuckoo_hash_empty                    (const cuckoo_hash_t * const __restrict__ ht);
+size_t                  get_cuckoo_hash_size                    (const cuckoo_hash_t * const __restrict__ ht);
+size_t                  get_cuckoo_hash_capacity                (const cuckoo_hash_t * const __restrict__ ht);
+error_t                 cuckoo_hash_memory_stats                (const cuckoo_hash_t * const __restrict__ ht, set_memory_stats_t * const stats);
+
+int32_t                 cuckoo_hash_get_max                     (const cuckoo_hash_t * const __restrict__ ht);
+int32_t                 cuckoo_hash_get_min                     (const cuckoo_hash_t * const __restrict__ ht);
+error_t                 cuckoo_hash_delete_max                  (cuckoo_hash_t * const __restrict__ ht);
+error_t                 cuckoo_hash_delete_min                  (cuckoo_hash_t * const __restrict__ ht);
+
+error_t                 cuckoo_hash_traverse_inorder            (const cuckoo_hash_t * const __restrict__ ht, FILE *fout);
+error_t                 cuckoo_hash_traverse_visit              (const cuckoo_hash_t * const __restrict__ ht, set_visit_func visit, void *context);
+
+extern const set_ops_t cuckoo_hash_set_ops;
+
+#endif /* CUCKOO_HASH_UTILS_H_ */
@@ -31,6 +31,7 @@
 #include <stdint.h>
 #include <errno.h>
 #include "config.h"
+#include "membership_filter.h"
 
 /**
  * @brief Color of one hash table node
@@ -64,6 +65,8 @@ typedef struct hash_table_linked_s {
     hash_func hash;                                             /* Pointer to a hash function */
     size_t capacity;                                            /* Number of red black trees within the hash table */
     size_t size;                                                /* Number of total nodes from hash table object*/
+    membership_filter_t *filter;                                /* Optional filter consulted before lookups, not owned */
+    set_memory_stats_t memory;                                  /* Memory accounting of the hash table */
 } hash_table_linked_t;
 
 hash_table_linked_t*    create_hash_table                       (size_t init_capacity, hash_func hash);
@@ -73,10 +76,13 @@ error_t                 hash_table_insert                       (hash_table_link
 error_t                 hash_table_delete                       (hash_table_linked_t * const __restrict__ ht, int32_t key);
 error_t                 hash_table_modify                       (hash_table_linked_t * const __restrict__ ht, int32_t old_key, int32_t new_key);
 uint8_t                 hash_table_includes                     (const hash_table_linked_t * const __restrict__ ht, int32_t key);
+size_t                  hash_table_includes_batch               (const hash_table_linked_t * const __restrict__ ht, const int32_t * const keys, size_t length, uint64_t * const out_bits);
+error_t                 hash_table_attach_filter                (hash_table_linked_t * const __restrict__ ht, membership_filter_t * const filter);
 
 uint8_t                 is_hash_table_empty                     (const hash_table_linked_t * const __restrict__ ht);
 size_t                  get_hash_table_size                     (const hash_table_linked_t * const __restrict__ ht);
 size_t                  get_hash_table_capacity                 (const hash_table_linked_t * const __restrict__ ht);
+error_t                 hash_table_memory_stats                 (const hash_table_linked_t * const __restrict__ ht, set_memory_stats_t * const stats);
 
 int32_t                 hash_table_get_max                      (const hash_table_linked_t * const __restrict__ ht);
 int32_t                 hash_table_get_min                      (const hash_table_linked_t * const __restrict__ ht);
@@ -84,5 +90,8 @@ error_t                 hash_table_delete_max                   (hash_table_link
 error_t                 hash_table_delete_min                   (hash_table_linked_t * const __restrict__ ht);
 
 error_t                 hash_table_traverse_inorder             (const hash_table_linked_t * const __restrict__ ht, FILE *fout);
+error_t                 hash_table_traverse_visit               (const hash_table_linked_t * const __restrict__ ht, set_visit_func visit, void *context);
+
+extern const set_ops_t hash_table_set_ops;
 
 #endif /* HASH_TABLE_LINKED_UTILS_H_ */
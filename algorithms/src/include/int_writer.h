@@ -0,0 +1,72 @@
+/**
+ * @file int_writer.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef INT_WRITER_UTILS_H_
+#define INT_WRITER_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include "config.h"
+
+#define INT_WRITER_BUFFER_SIZE                      (1 << 16)
+#define INT_WRITER_MAX_DIGITS                       12
+#define INT_WRITER_PENDING_KEYS                     256
+
+/**
+ * @brief Buffered integer writer, keys are formatted two digits at a time
+ * into a large buffer that is handed to the kernel with a single write once
+ * it fills up, instead of one fprintf (and one format string parse) per key.
+ * Keys are first staged and formatted in batches, so a traversal feeding the
+ * writer keeps several node loads in flight instead of waiting on each node
+ * while the previous key is formatted. The writer flushes either to a file
+ * descriptor or, for streams without one, with fwrite
+ * 
+ */
+typedef struct int_writer_s {
+    char *buffer;                                               /* Pending output, not yet written */
+    size_t length;                                              /* Number of pending bytes */
+    size_t capacity;                                            /* Size of the buffer in bytes */
+    int fd;                                                     /* Destination descriptor, -1 when writing to stream */
+    FILE *stream;                                               /* Destination stream when it has no descriptor */
+    error_t status;                                             /* First write error, later writes are dropped */
+    size_t pending_length;                                      /* Number of staged keys */
+    int32_t pending[INT_WRITER_PENDING_KEYS];                   /* Keys staged for formatting */
+} int_writer_t;
+
+int_writer_t*           create_int_writer                       (int fd, size_t capacity);
+int_writer_t*           create_int_writer_stream                (FILE *fout, size_t capacity);
+error_t                 free_int_writer                         (int_writer_t * const __restrict__ writer);
+
+error_t                 int_writer_flush                        (int_writer_t * const __restrict__ writer);
+error_t                 int_writer_put_bytes                    (int_writer_t * const __restrict__ writer, const char *bytes, size_t length);
+error_t                 int_writer_put_int                      (int_writer_t * const __restrict__ writer, int32_t key);
+void                    int_writer_visit                        (int32_t key, void *context);
+
+size_t                  int_writer_format                       (int32_t key, char * const dest);
+
+#endif /* INT_WRITER_UTILS_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @file membership_filter.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef MEMBERSHIP_FILTER_UTILS_H_
+#define MEMBERSHIP_FILTER_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "config.h"
+
+#define FILTER_BLOCK_WORDS                          8
+#define FILTER_HASH_PROBES                          6
+
+/**
+ * @brief Membership filter counters, a lookup is a positive when the
+ * filter could not rule the key out, a false positive when the positive
+ * lookup was not confirmed by the data structure behind the filter
+ * 
+ */
+typedef struct membership_filter_stats_s {
+    size_t lookups;                                             /* Number of times the filter was consulted */
+    size_t negatives;                                           /* Lookups answered by the filter alone */
+    size_t positives;                                           /* Lookups passed to the data structure */
+    size_t false_positives;                                     /* Positive lookups for keys not in the data structure */
+} membership_filter_stats_t;
+
+/**
+ * @brief Counting blocked Bloom filter object definition, every key lives
+ * in one cache line block of 128 four bit counters, so deletion is supported
+ * and a lookup costs a single cache line access
+ * 
+ */
+typedef struct membership_filter_s {
+    uint64_t *blocks;                                           /* Array of blocks, FILTER_BLOCK_WORDS words per block */
+    size_t block_mask;                                          /* Number of blocks minus one, blocks are a power of two */
+    membership_filter_stats_t stats;                            /* Hit and false positive counters */
+} membership_filter_t;
+
+membership_filter_t*    create_membership_filter                (size_t expected_keys);
+error_t                 free_membership_filter                  (membership_filter_t * const __restrict__ filter);
+error_t                 membership_filter_clear                 (membership_filter_t * const __restrict__ filter);
+
+error_t                 membership_filter_insert                (membership_filter_t * const __restrict__ filter, int32_t key);
+error_t                 membership_filter_delete                (membership_filter_t * const __restrict__ filter, int32_t key);
+uint8_t                 membership_filter_may_include           (const membership_filter_t * const __restrict__ filter, int32_t key);
+
+uint8_t                 membership_filter_lookup                (membership_filter_t * const __restrict__ filter, int32_t key);
+void                    membership_filter_confirm               (membership_filter_t * const __restrict__ filter, uint8_t found);
+
+membership_filter_stats_t   get_membership_filter_stats         (const membership_filter_t * const __restrict__ filter);
+void                    reset_membership_filter_stats           (membership_filter_t * const __restrict__ filter);
+double                  membership_filter_negative_rate         (const membership_filter_t * const __restrict__ filter);
+double                  membership_filter_false_positive_rate   (const membership_filter_t * const __restrict__ filter);
+
+#endif /* MEMBERSHIP_FILTER_UTILS_H_ */
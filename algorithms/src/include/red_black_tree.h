@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <stdint.h>
 #include "config.h"
+#include "membership_filter.h"
 
 /**
  * @brief Color of one red-black tree node
@@ -62,19 +63,30 @@ typedef struct rbk_tree_s {
     rbk_tree_node_t *root;                                      /* Pointer to tree root */
     rbk_tree_node_t *nil;                                       /* Black hole pointer */
     size_t size;                                                /* Size of the red-black tree */
+    membership_filter_t *filter;                                /* Optional filter consulted before lookups, not owned */
+    rbk_tree_node_t *finger;                                    /* Last inserted node in finger mode, nil when unknown */
+    rbk_tree_node_t *rightmost;                                 /* Largest node in finger mode, nil when unknown */
+    uint8_t finger_mode;                                        /* Inserts start from the finger when non zero */
+    set_memory_stats_t memory;                                  /* Memory accounting of the tree */
 } rbk_tree_t;
 
 rbk_tree_t*             create_rbk                          (void);
 error_t                 free_rbk                            (rbk_tree_t * const __restrict__ tree);
 
 error_t                 rbk_insert                          (rbk_tree_t * const __restrict__ tree, int32_t data);
+error_t                 rbk_insert_finger_mode              (rbk_tree_t * const __restrict__ tree, uint8_t enabled);
 error_t                 rbk_delete                          (rbk_tree_t * const __restrict__ tree, int32_t data);
 error_t                 rbk_modify_data                     (rbk_tree_t * const __restrict__ tree, int32_t old_data, int32_t new_data);
 
 uint8_t                 is_rbk_empty                        (const rbk_tree_t * const __restrict__ tree);
 int32_t                 get_rbk_root                        (const rbk_tree_t * const __restrict__ tree);
 size_t                  get_rbk_size                        (const rbk_tree_t * const __restrict__ tree);
+error_t                 rbk_memory_stats                    (const rbk_tree_t * const __restrict__ tree, set_memory_stats_t * const stats);
 uint8_t                 rbk_includes                        (const rbk_tree_t * const __restrict__ tree, int32_t data);
+size_t                  rbk_includes_sorted_batch           (const rbk_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, uint8_t * const found);
+/* For every key the smallest stored key >= it, INT32_MAX when there is none (the same as a stored INT32_MAX), returns the keys with a bound */
+size_t                  rbk_lower_bound_batch               (const rbk_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, int32_t * const bounds);
+error_t                 rbk_attach_filter                   (rbk_tree_t * const __restrict__ tree, membership_filter_t * const filter);
 
 int32_t                 rbk_max_data                        (const rbk_tree_t * const __restrict__ tree);
 int32_t                 rbk_min_data                        (const rbk_tree_t * const __restrict__ tree);
@@ -82,5 +94,8 @@ error_t                 rbk_delete_max                      (rbk_tree_t * const
 error_t                 rbk_delete_min                      (rbk_tree_t * const __restrict__ tree);
 
 error_t                 rbk_traverse_inorder                (const rbk_tree_t * const __restrict__ tree, FILE *fout);
+error_t                 rbk_traverse_visit                  (const rbk_tree_t * const __restrict__ tree, set_visit_func visit, void *context);
+
+extern const set_ops_t rbk_set_ops;
 
 #endif /* _RED_BLACK_TREE_UTILS_H_ */
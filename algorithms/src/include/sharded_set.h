@@ -0,0 +1,104 @@
+/**
+ * @file sharded_set.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#ifndef SHARDED_SET_UTILS_H_
+#define SHARDED_SET_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <pthread.h>
+#include "config.h"
+
+#define SHARDED_SET_CACHE_LINE                      64
+#define SHARDED_SET_DEFAULT_SHARDS                  16
+
+/**
+ * @brief How keys are routed to the shards, the hash partition spreads
+ * any key distribution evenly, the range partition gives every shard a
+ * contiguous slice of the key space
+ * 
+ */
+typedef enum sharded_set_partition_s {
+    SHARDED_HASH_PARTITION,                                     /* Shard chosen by a multiplicative hash of the key */
+    SHARDED_RANGE_PARTITION                                     /* Shard chosen by the slice of the key range holding the key */
+} sharded_set_partition_t;
+
+/**
+ * @brief Sharded Set shard definition, one engine instance guarded by
+ * its own lock, the header is cache line aligned so threads working on
+ * different shards never write to the same cache line
+ * 
+ */
+typedef struct sharded_set_shard_s {
+    pthread_mutex_t lock;                                       /* Lock taken by every operation on the shard */
+    void *set;                                                  /* Engine instance holding the keys of the shard */
+} __attribute__((aligned(SHARDED_SET_CACHE_LINE))) sharded_set_shard_t;
+
+/**
+ * @brief Sharded Set object definition, owns shard_count instances
+ * of the same engine and forwards every key to exactly one of them
+ * 
+ */
+typedef struct sharded_set_s {
+    const set_ops_t *ops;                                       /* Engine used by every shard */
+    sharded_set_shard_t *shards;                                /* Array of cache line aligned shards */
+    size_t shard_count;                                         /* Number of shards */
+    sharded_set_partition_t partition;                          /* Routing of the keys to the shards */
+    int32_t range_min;                                          /* First key of the first shard for the range partition */
+    uint64_t range_width;                                       /* Number of keys of every shard for the range partition */
+    set_memory_stats_t memory;                                  /* Memory accounting of the header and the shard array */
+} sharded_set_t;
+
+sharded_set_t*          create_sharded_set                      (const set_ops_t * const ops, size_t shard_count, size_t capacity_hint, hash_func hash);
+sharded_set_t*          create_sharded_set_range                (const set_ops_t * const ops, size_t shard_count, size_t capacity_hint, hash_func hash, int32_t range_min, int32_t range_max);
+error_t                 free_sharded_set                        (sharded_set_t * const __restrict__ set);
+
+size_t                  sharded_set_shard_index                 (const sharded_set_t * const __restrict__ set, int32_t key);
+
+error_t                 sharded_set_insert                      (sharded_set_t * const __restrict__ set, int32_t key);
+error_t                 sharded_set_delete                      (sharded_set_t * const __restrict__ set, int32_t key);
+error_t                 sharded_set_modify                      (sharded_set_t * const __restrict__ set, int32_t old_key, int32_t new_key);
+uint8_t                 sharded_set_includes                    (const sharded_set_t * const __restrict__ set, int32_t key);
+
+uint8_t                 is_sharded_set_empty                    (const sharded_set_t * const __restrict__ set);
+size_t                  get_sharded_set_size                    (const sharded_set_t * const __restrict__ set);
+error_t                 sharded_set_memory_stats                (const sharded_set_t * const __restrict__ set, set_memory_stats_t * const stats);
+
+int32_t                 sharded_set_get_max                     (const sharded_set_t * const __restrict__ set);
+int32_t                 sharded_set_get_min                     (const sharded_set_t * const __restrict__ set);
+error_t                 sharded_set_delete_max                  (sharded_set_t * const __restrict__ set);
+error_t                 sharded_set_delete_min                  (sharded_set_t * const __restrict__ set);
+
+error_t                 sharded_set_traverse_visit              (const sharded_set_t * const __restrict__ set, set_visit_func visit, void *context);
+error_t                 sharded_set_traverse_inorder            (const sharded_set_t * const __restrict__ set, FILE *fout);
+
+extern const set_ops_t sharded_avl_set_ops;
+extern const set_ops_t sharded_rbk_set_ops;
+extern const set_ops_t sharded_hash_table_set_ops;
+
+#endif /* SHARDED_SET_UTILS_H_ */
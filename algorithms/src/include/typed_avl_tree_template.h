@@ -0,0 +1,541 @@
+/**
+ * @file typed_avl_tree_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/* No include guard, the template is included once for every instantiation */
+
+#include "typed_set_template.h"
+
+#if !defined(TYPED_SET_NAME) || !defined(TYPED_SET_TRAITS)
+#error "TYPED_SET_NAME and TYPED_SET_TRAITS must be defined before including typed_avl_tree_template.h"
+#endif
+
+/**
+ * @brief Typed Adelson-Velsky-Landis Tree Node object definition
+ * 
+ */
+typedef struct TYPED_FN(_node_s) {
+    TYPED_KEY data;                                             /* Key of the node */
+    struct TYPED_FN(_node_s) *parent;                           /* Pointer to parent node */
+    struct TYPED_FN(_node_s) *left;                             /* Pointer to left child node */
+    struct TYPED_FN(_node_s) *right;                            /* Pointer to right child node */
+    uint32_t count;                                             /* Number of nodes with the same data value */
+    uint32_t height;                                            /* Height of a node */
+#ifdef TYPED_SET_MAP
+    _Alignas(max_align_t) unsigned char value[];                /* Inline payload of value_size bytes */
+#endif
+} TYPED_NODE;
+
+/**
+ * @brief Typed Adelson-Velsky-Landis Tree object definition
+ * 
+ */
+typedef struct TYPED_FN(_s) {
+    TYPED_NODE *root;                                           /* Pointer to tree root */
+    TYPED_NODE *nil;                                            /* Black hole pointer */
+    size_t size;                                                /* Size of the avl tree */
+#ifdef TYPED_SET_MAP
+    size_t value_size;                                          /* Size of the payload stored in every node */
+#endif
+} TYPED_SET;
+
+#ifdef TYPED_SET_MAP
+#define TYPED_NODE_SIZE(SET) (sizeof(TYPED_NODE) + (SET)->value_size)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (size_t value_size);
+#else
+#define TYPED_NODE_SIZE(SET) sizeof(TYPED_NODE)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (void);
+#endif
+error_t                 TYPED_PREFIX_FN(free_, )            (TYPED_SET * const __restrict__ tree);
+
+#ifndef TYPED_SET_MAP
+error_t                 TYPED_FN(_insert)                   (TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+error_t                 TYPED_FN(_modify_data)              (TYPED_SET * const __restrict__ tree, TYPED_PARAM old_data, TYPED_PARAM new_data);
+#endif
+error_t                 TYPED_FN(_delete)                   (TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+
+uint8_t                 TYPED_PREFIX_FN(is_, _empty)        (const TYPED_SET * const __restrict__ tree);
+size_t                  TYPED_PREFIX_FN(get_, _size)        (const TYPED_SET * const __restrict__ tree);
+uint8_t                 TYPED_FN(_includes)                 (const TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+
+TYPED_PARAM             TYPED_FN(_max_data)                 (const TYPED_SET * const __restrict__ tree);
+TYPED_PARAM             TYPED_FN(_min_data)                 (const TYPED_SET * const __restrict__ tree);
+error_t                 TYPED_FN(_delete_max)               (TYPED_SET * const __restrict__ tree);
+error_t                 TYPED_FN(_delete_min)               (TYPED_SET * const __restrict__ tree);
+
+error_t                 TYPED_FN(_traverse_inorder)         (const TYPED_SET * const __restrict__ tree, FILE *fout);
+
+#ifdef TYPED_SET_IMPLEMENTATION
+
+#ifdef TYPED_SET_MAP
+TYPED_SET* TYPED_PREFIX_FN(create_, )(size_t value_size) {
+#else
+TYPED_SET* TYPED_PREFIX_FN(create_, )(void) {
+#endif
+    TYPED_SET *new_tree = malloc(sizeof(*new_tree));
+
+    if (NULL != new_tree) {
+        new_tree->nil = calloc(1, sizeof(*new_tree->nil));
+
+        if (NULL != new_tree->nil) {
+            new_tree->nil->left = new_tree->nil->right = new_tree->nil;
+            new_tree->nil->parent = new_tree->nil;
+        } else {
+            free(new_tree);
+            new_tree = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for nil typed avl allocation");
+
+            return NULL;
+        }
+
+        new_tree->root = new_tree->nil;
+        new_tree->size = 0;
+#ifdef TYPED_SET_MAP
+        new_tree->value_size = value_size;
+#endif
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for typed avl allocation");
+    }
+
+    return new_tree;
+}
+
+static void TYPED_FN(_free_helper)(const TYPED_SET * const __restrict__ tree, TYPED_NODE * const __restrict__ root) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    TYPED_FN(_free_helper)(tree, root->left);
+    TYPED_FN(_free_helper)(tree, root->right);
+
+    TYPED_TRAIT(_release)(root->data);
+    free(root);
+}
+
+error_t TYPED_PREFIX_FN(free_, )(TYPED_SET * const __restrict__ tree) {
+    if (NULL != tree) {
+        TYPED_FN(_free_helper)(tree, tree->root);
+
+        free(tree->nil);
+        tree->nil = NULL;
+        free(tree);
+
+        return SCL_OK;
+    }
+
+    return SCL_NULL_AVL;
+}
+
+static void TYPED_FN(_update_height)(TYPED_NODE * const __restrict__ node) {
+    node->height = ((node->left->height >= node->right->height) ? node->left->height : node->right->height) + 1;
+}
+
+static void TYPED_FN(_replace_child)(TYPED_SET * const __restrict__ tree, TYPED_NODE * const old_child, TYPED_NODE * const new_child) {
+    if (tree->nil == old_child->parent) {
+        tree->root = new_child;
+    } else if (old_child->parent->left == old_child) {
+        old_child->parent->left = new_child;
+    } else {
+        old_child->parent->right = new_child;
+    }
+}
+
+static TYPED_NODE* TYPED_FN(_rotate_left)(TYPED_SET * const __restrict__ tree, TYPED_NODE * const fix_node) {
+    TYPED_NODE * const rotate_node = fix_node->right;
+
+    fix_node->right = rotate_node->left;
+
+    if (tree->nil != rotate_node->left) {
+        rotate_node->left->parent = fix_node;
+    }
+
+    rotate_node->parent = fix_node->parent;
+    TYPED_FN(_replace_child)(tree, fix_node, rotate_node);
+
+    rotate_node->left = fix_node;
+    fix_node->parent = rotate_node;
+
+    TYPED_FN(_update_height)(fix_node);
+    TYPED_FN(_update_height)(rotate_node);
+
+    return rotate_node;
+}
+
+static TYPED_NODE* TYPED_FN(_rotate_right)(TYPED_SET * const __restrict__ tree, TYPED_NODE * const fix_node) {
+    TYPED_NODE * const rotate_node = fix_node->left;
+
+    fix_node->left = rotate_node->right;
+
+    if (tree->nil != rotate_node->right) {
+        rotate_node->right->parent = fix_node;
+    }
+
+    rotate_node->parent = fix_node->parent;
+    TYPED_FN(_replace_child)(tree, fix_node, rotate_node);
+
+    rotate_node->right = fix_node;
+    fix_node->parent = rotate_node;
+
+    TYPED_FN(_update_height)(fix_node);
+    TYPED_FN(_update_height)(rotate_node);
+
+    return rotate_node;
+}
+
+static void TYPED_FN(_fix_node_up)(TYPED_SET * const __restrict__ tree, TYPED_NODE *fix_node) {
+    while (tree->nil != fix_node) {
+        TYPED_FN(_update_height)(fix_node);
+
+        int64_t balance_factor = (int64_t)fix_node->left->height - fix_node->right->height;
+
+        if (balance_factor > 1) {
+            if (fix_node->left->left->height < fix_node->left->right->height) {
+                TYPED_FN(_rotate_left)(tree, fix_node->left);
+            }
+
+            fix_node = TYPED_FN(_rotate_right)(tree, fix_node);
+        } else if (balance_factor < -1) {
+            if (fix_node->right->right->height < fix_node->right->left->height) {
+                TYPED_FN(_rotate_right)(tree, fix_node->right);
+            }
+
+            fix_node = TYPED_FN(_rotate_left)(tree, fix_node);
+        }
+
+        fix_node = fix_node->parent;
+    }
+}
+
+/*
+ * Returns the node holding the key, creating it when the key is missing,
+ * and NULL when the node allocation failed.
+ */
+static TYPED_NODE* TYPED_FN(_insert_key)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data, uint8_t * const created) {
+    TYPED_NODE *iterator = tree->root;
+    TYPED_NODE *parent_iterator = tree->nil;
+    int32_t compare = 0;
+
+    *created = 0;
+
+    while (tree->nil != iterator) {
+        parent_iterator = iterator;
+        compare = TYPED_TRAIT(_compare)(data, iterator->data);
+
+        if (compare < 0) {
+            iterator = iterator->left;
+        } else if (compare > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    TYPED_NODE *new_node = malloc(TYPED_NODE_SIZE(tree));
+
+    if ((NULL == new_node) || (0 == TYPED_TRAIT(_copy)(data, &new_node->data))) {
+        free(new_node);
+
+        errno = ENOMEM;
+        perror("Not enough memory for node typed avl allocation");
+
+        return NULL;
+    }
+
+#ifdef TYPED_SET_MAP
+    memset(new_node->value, 0, tree->value_size);
+#endif
+
+    new_node->left = new_node->right = tree->nil;
+    new_node->parent = parent_iterator;
+    new_node->count = 1;
+    new_node->height = 1;
+
+    if (tree->nil == parent_iterator) {
+        tree->root = new_node;
+    } else if (compare < 0) {
+        parent_iterator->left = new_node;
+    } else {
+        parent_iterator->right = new_node;
+    }
+
+    TYPED_FN(_fix_node_up)(tree, parent_iterator);
+
+    ++(tree->size);
+    *created = 1;
+
+    return new_node;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_insert)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    uint8_t created = 0;
+    TYPED_NODE *node = TYPED_FN(_insert_key)(tree, data, &created);
+
+    if (NULL == node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    if (0 == created) {
+        ++(node->count);
+    }
+
+    return SCL_OK;
+}
+#endif
+
+static TYPED_NODE* TYPED_FN(_find_node)(const TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    TYPED_NODE *iterator = tree->root;
+
+    while (tree->nil != iterator) {
+        int32_t compare = TYPED_TRAIT(_compare)(data, iterator->data);
+
+        if (compare < 0) {
+            iterator = iterator->left;
+        } else if (compare > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    return tree->nil;
+}
+
+static TYPED_NODE* TYPED_FN(_min_node)(const TYPED_SET * const __restrict__ tree, TYPED_NODE * __restrict__ root) {
+    if (tree->nil != root) {
+        while (tree->nil != root->left) {
+            root = root->left;
+        }
+    }
+
+    return root;
+}
+
+static TYPED_NODE* TYPED_FN(_max_node)(const TYPED_SET * const __restrict__ tree, TYPED_NODE * __restrict__ root) {
+    if (tree->nil != root) {
+        while (tree->nil != root->right) {
+            root = root->right;
+        }
+    }
+
+    return root;
+}
+
+static void TYPED_FN(_delete_node)(TYPED_SET * const __restrict__ tree, TYPED_NODE * const delete_node) {
+    TYPED_NODE *fix_node = delete_node->parent;
+
+    if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
+        /* Relink the successor in place of the deleted node, so nodes (and their payloads) never move */
+        TYPED_NODE *successor = TYPED_FN(_min_node)(tree, delete_node->right);
+
+        if (delete_node == successor->parent) {
+            fix_node = successor;
+        } else {
+            fix_node = successor->parent;
+            fix_node->left = successor->right;
+
+            if (tree->nil != successor->right) {
+                successor->right->parent = fix_node;
+            }
+
+            successor->right = delete_node->right;
+            successor->right->parent = successor;
+        }
+
+        successor->left = delete_node->left;
+        successor->left->parent = successor;
+        successor->parent = delete_node->parent;
+        successor->height = delete_node->height;
+
+        TYPED_FN(_replace_child)(tree, delete_node, successor);
+    } else {
+        TYPED_NODE *child_node = (tree->nil != delete_node->left) ? delete_node->left : delete_node->right;
+
+        if (tree->nil != child_node) {
+            child_node->parent = delete_node->parent;
+        }
+
+        TYPED_FN(_replace_child)(tree, delete_node, child_node);
+    }
+
+    TYPED_TRAIT(_release)(delete_node->data);
+    free(delete_node);
+
+    --(tree->size);
+
+    TYPED_FN(_fix_node_up)(tree, fix_node);
+}
+
+error_t TYPED_FN(_delete)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_NODE *delete_node = TYPED_FN(_find_node)(tree, data);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    TYPED_FN(_delete_node)(tree, delete_node);
+
+    return SCL_OK;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_modify_data)(TYPED_SET * const __restrict__ tree, TYPED_PARAM old_data, TYPED_PARAM new_data) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    error_t err = TYPED_FN(_delete)(tree, old_data);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    return TYPED_FN(_insert)(tree, new_data);
+}
+#endif
+
+uint8_t TYPED_PREFIX_FN(is_, _empty)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root) || (0 == tree->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+size_t TYPED_PREFIX_FN(get_, _size)(const TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->size;
+}
+
+uint8_t TYPED_FN(_includes)(const TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return 0;
+    }
+
+    return (tree->nil != TYPED_FN(_find_node)(tree, data));
+}
+
+TYPED_PARAM TYPED_FN(_max_data)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_max_node)(tree, tree->root)->data;
+}
+
+TYPED_PARAM TYPED_FN(_min_data)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_min_node)(tree, tree->root)->data;
+}
+
+error_t TYPED_FN(_delete_max)(TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_FN(_delete_node)(tree, TYPED_FN(_max_node)(tree, tree->root));
+
+    return SCL_OK;
+}
+
+error_t TYPED_FN(_delete_min)(TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_FN(_delete_node)(tree, TYPED_FN(_min_node)(tree, tree->root));
+
+    return SCL_OK;
+}
+
+static void TYPED_FN(_traverse_inorder_helper)(const TYPED_SET * const __restrict__ tree, const TYPED_NODE * const __restrict__ root, FILE *fout) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    TYPED_FN(_traverse_inorder_helper)(tree, root->left, fout);
+    TYPED_TRAIT(_print)(fout, root->data);
+    TYPED_FN(_traverse_inorder_helper)(tree, root->right, fout);
+}
+
+error_t TYPED_FN(_traverse_inorder)(const TYPED_SET * const __restrict__ tree, FILE *fout) {
+    if (NULL == tree) {
+        return SCL_NULL_AVL;
+    }
+
+    if (tree->nil == tree->root) {
+        fprintf(fout, "(Null)\n");
+    } else {
+        TYPED_FN(_traverse_inorder_helper)(tree, tree->root, fout);
+        fprintf(fout, "\n");
+    }
+
+    return SCL_OK;
+}
+
+static inline TYPED_NODE* TYPED_FN(_lookup_node)(const TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    TYPED_NODE *node = TYPED_FN(_find_node)(tree, data);
+
+    return (tree->nil != node) ? node : NULL;
+}
+
+#endif /* TYPED_SET_IMPLEMENTATION */
+
+#ifdef TYPED_SET_MAP
+#define TYPED_SET_NULL_ERROR SCL_NULL_AVL
+#include "typed_map_template.h"
+#endif
+
+#undef TYPED_NODE_SIZE
+#undef TYPED_SET_NAME
+#undef TYPED_SET_TRAITS
+#undef TYPED_SET_MAP
@@ -0,0 +1,435 @@
+/**
+ * @file typed_hash_table_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/* No include guard, the template is included once for every instantiation */
+
+#if !defined(TYPED_SET_NAME) || !defined(TYPED_SET_TRAITS)
+#error "TYPED_SET_NAME and TYPED_SET_TRAITS must be defined before including typed_hash_table_template.h"
+#endif
+
+#include "typed_rbk_core_template.h"
+
+/**
+ * @brief Typed Hash Table object definition, every bucket is a red-black
+ * tree and the key hash is inlined from the key traits
+ * 
+ */
+typedef struct TYPED_FN(_s) {
+    TYPED_NODE **buckets;                                       /* Array of pointers of red black trees */
+    TYPED_NODE *nil;                                            /* Black hole pointer shared by all buckets */
+    size_t capacity;                                            /* Number of red black trees within the hash table */
+    size_t size;                                                /* Number of total nodes from hash table object */
+#ifdef TYPED_SET_MAP
+    size_t value_size;                                          /* Size of the payload stored in every node */
+#endif
+} TYPED_SET;
+
+#ifdef TYPED_SET_MAP
+#define TYPED_NODE_SIZE(SET) (sizeof(TYPED_NODE) + (SET)->value_size)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (size_t init_capacity, size_t value_size);
+#else
+#define TYPED_NODE_SIZE(SET) sizeof(TYPED_NODE)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (size_t init_capacity);
+#endif
+error_t                 TYPED_PREFIX_FN(free_, )            (TYPED_SET * const __restrict__ ht);
+
+#ifndef TYPED_SET_MAP
+error_t                 TYPED_FN(_insert)                   (TYPED_SET * const __restrict__ ht, TYPED_PARAM key);
+error_t                 TYPED_FN(_modify)                   (TYPED_SET * const __restrict__ ht, TYPED_PARAM old_key, TYPED_PARAM new_key);
+#endif
+error_t                 TYPED_FN(_delete)                   (TYPED_SET * const __restrict__ ht, TYPED_PARAM key);
+uint8_t                 TYPED_FN(_includes)                 (const TYPED_SET * const __restrict__ ht, TYPED_PARAM key);
+
+uint8_t                 TYPED_PREFIX_FN(is_, _empty)        (const TYPED_SET * const __restrict__ ht);
+size_t                  TYPED_PREFIX_FN(get_, _size)        (const TYPED_SET * const __restrict__ ht);
+size_t                  TYPED_PREFIX_FN(get_, _capacity)    (const TYPED_SET * const __restrict__ ht);
+
+TYPED_PARAM             TYPED_FN(_get_max)                  (const TYPED_SET * const __restrict__ ht);
+TYPED_PARAM             TYPED_FN(_get_min)                  (const TYPED_SET * const __restrict__ ht);
+error_t                 TYPED_FN(_delete_max)               (TYPED_SET * const __restrict__ ht);
+error_t                 TYPED_FN(_delete_min)               (TYPED_SET * const __restrict__ ht);
+
+error_t                 TYPED_FN(_traverse_inorder)         (const TYPED_SET * const __restrict__ ht, FILE *fout);
+
+#ifdef TYPED_SET_IMPLEMENTATION
+
+#ifndef TYPED_HASH_DEFAULT_CAPACITY
+#define TYPED_HASH_DEFAULT_CAPACITY 50
+#define TYPED_HASH_LOAD_FACTOR 0.75
+#define TYPED_HASH_CAPACITY_RATIO 2
+#endif
+
+#ifdef TYPED_SET_MAP
+TYPED_SET* TYPED_PREFIX_FN(create_, )(size_t init_capacity, size_t value_size) {
+#else
+TYPED_SET* TYPED_PREFIX_FN(create_, )(size_t init_capacity) {
+#endif
+    if (10 >= init_capacity) {
+        init_capacity = TYPED_HASH_DEFAULT_CAPACITY;
+    }
+
+    TYPED_SET *new_hash_table = malloc(sizeof(*new_hash_table));
+
+    if (NULL != new_hash_table) {
+        new_hash_table->capacity = init_capacity;
+        new_hash_table->size = 0;
+#ifdef TYPED_SET_MAP
+        new_hash_table->value_size = value_size;
+#endif
+
+        new_hash_table->nil = calloc(1, sizeof(*new_hash_table->nil));
+
+        if (NULL == new_hash_table->nil) {
+            free(new_hash_table);
+
+            errno = ENOMEM;
+            perror("Not enough memory for nil typed hash table allocation");
+
+            return NULL;
+        }
+
+        new_hash_table->nil->parent = new_hash_table->nil->left = new_hash_table->nil->right = new_hash_table->nil;
+        new_hash_table->nil->color = TYPED_BLACK;
+
+        new_hash_table->buckets = malloc(sizeof(*new_hash_table->buckets) * init_capacity);
+
+        if (NULL == new_hash_table->buckets) {
+            free(new_hash_table->nil);
+            free(new_hash_table);
+
+            errno = ENOMEM;
+            perror("Not enough memory for buckets of typed hash table");
+
+            return NULL;
+        }
+
+        for (size_t iter = 0; iter < init_capacity; ++iter) {
+            new_hash_table->buckets[iter] = new_hash_table->nil;
+        }
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for typed hash table allocation");
+    }
+
+    return new_hash_table;
+}
+
+error_t TYPED_PREFIX_FN(free_, )(TYPED_SET * const __restrict__ ht) {
+    if (NULL != ht) {
+        if (NULL != ht->buckets) {
+            for (size_t iter = 0; iter < ht->capacity; ++iter) {
+                TYPED_FN(_rb_free_nodes)(ht->buckets[iter], ht->nil);
+            }
+
+            free(ht->buckets);
+            ht->buckets = NULL;
+        }
+
+        free(ht->nil);
+        ht->nil = NULL;
+        free(ht);
+
+        return SCL_OK;
+    }
+
+    return SCL_NULL_HASH_TABLE;
+}
+
+static TYPED_NODE** TYPED_FN(_bucket)(const TYPED_SET * const __restrict__ ht, TYPED_PARAM key) {
+    return &ht->buckets[TYPED_TRAIT(_hash)(key) % ht->capacity];
+}
+
+static void TYPED_FN(_rehash)(TYPED_SET * const __restrict__ ht) {
+    size_t old_capacity = ht->capacity;
+    TYPED_NODE **old_buckets = ht->buckets;
+    TYPED_NODE **new_buckets = malloc(sizeof(*new_buckets) * old_capacity * TYPED_HASH_CAPACITY_RATIO);
+
+    if (NULL == new_buckets) {
+        /* Keep the current buckets, the table still works with longer chains */
+        return;
+    }
+
+    ht->capacity = old_capacity * TYPED_HASH_CAPACITY_RATIO;
+    ht->buckets = new_buckets;
+
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        ht->buckets[iter] = ht->nil;
+    }
+
+    /* Nodes are moved between the buckets, keys are neither copied nor released */
+    for (size_t iter = 0; iter < old_capacity; ++iter) {
+        while (ht->nil != old_buckets[iter]) {
+            TYPED_NODE *move_node = old_buckets[iter];
+
+            TYPED_FN(_rb_unlink_node)(&old_buckets[iter], ht->nil, move_node);
+            TYPED_FN(_rb_link_node)(TYPED_FN(_bucket)(ht, move_node->data), ht->nil, move_node);
+        }
+    }
+
+    free(old_buckets);
+}
+
+/*
+ * Returns the node holding the key, creating it when the key is missing,
+ * and NULL when the node allocation failed. A rehash relinks the nodes,
+ * so the returned node stays valid.
+ */
+static TYPED_NODE* TYPED_FN(_insert_key)(TYPED_SET * const __restrict__ ht, TYPED_PARAM key, uint8_t * const created) {
+    TYPED_NODE *node = TYPED_FN(_rb_insert)(TYPED_FN(_bucket)(ht, key), ht->nil, key, TYPED_NODE_SIZE(ht), created);
+
+    if (ht->nil == node) {
+        return NULL;
+    }
+
+    ht->size += *created;
+
+    if ((1.0 * ht->size) / ht->capacity > TYPED_HASH_LOAD_FACTOR) {
+        TYPED_FN(_rehash)(ht);
+    }
+
+    return node;
+}
+
+static inline TYPED_NODE* TYPED_FN(_lookup_node)(const TYPED_SET * const __restrict__ ht, TYPED_PARAM key) {
+    TYPED_NODE *node = TYPED_FN(_rb_find)(*TYPED_FN(_bucket)(ht, key), ht->nil, key);
+
+    return (ht->nil != node) ? node : NULL;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_insert)(TYPED_SET * const __restrict__ ht, TYPED_PARAM key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    uint8_t created = 0;
+    TYPED_NODE *node = TYPED_FN(_insert_key)(ht, key, &created);
+
+    if (NULL == node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    if (0 == created) {
+        ++(node->count);
+    }
+
+    return SCL_OK;
+}
+#endif
+
+static void TYPED_FN(_delete_node)(TYPED_SET * const __restrict__ ht, TYPED_NODE ** const bucket, TYPED_NODE * const delete_node) {
+    TYPED_FN(_rb_unlink_node)(bucket, ht->nil, delete_node);
+
+    TYPED_TRAIT(_release)(delete_node->data);
+    free(delete_node);
+
+    --(ht->size);
+}
+
+error_t TYPED_FN(_delete)(TYPED_SET * const __restrict__ ht, TYPED_PARAM key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_NODE **bucket = TYPED_FN(_bucket)(ht, key);
+    TYPED_NODE *delete_node = TYPED_FN(_rb_find)(*bucket, ht->nil, key);
+
+    if (ht->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    TYPED_FN(_delete_node)(ht, bucket, delete_node);
+
+    return SCL_OK;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_modify)(TYPED_SET * const __restrict__ ht, TYPED_PARAM old_key, TYPED_PARAM new_key) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    error_t err = TYPED_FN(_delete)(ht, old_key);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    return TYPED_FN(_insert)(ht, new_key);
+}
+#endif
+
+uint8_t TYPED_FN(_includes)(const TYPED_SET * const __restrict__ ht, TYPED_PARAM key) {
+    if ((NULL == ht) || (NULL == ht->buckets)) {
+        return 0;
+    }
+
+    return (ht->nil != TYPED_FN(_rb_find)(*TYPED_FN(_bucket)(ht, key), ht->nil, key));
+}
+
+uint8_t TYPED_PREFIX_FN(is_, _empty)(const TYPED_SET * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->capacity) || (0 == ht->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+size_t TYPED_PREFIX_FN(get_, _size)(const TYPED_SET * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->size;
+}
+
+size_t TYPED_PREFIX_FN(get_, _capacity)(const TYPED_SET * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SIZE_MAX;
+    }
+
+    return ht->capacity;
+}
+
+/*
+ * Scans the bucket extremes and returns the bucket index holding the
+ * largest (sign 1) or smallest (sign -1) key, capacity when the table is empty.
+ */
+static size_t TYPED_FN(_extreme_bucket)(const TYPED_SET * const __restrict__ ht, int32_t sign) {
+    size_t extreme_bucket = ht->capacity;
+    const TYPED_NODE *extreme_node = ht->nil;
+
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        if (ht->nil != ht->buckets[iter]) {
+            const TYPED_NODE *temp = (sign > 0) ? TYPED_FN(_rb_max_node)(ht->buckets[iter], ht->nil)
+                                                : TYPED_FN(_rb_min_node)(ht->buckets[iter], ht->nil);
+
+            if ((ht->nil == extreme_node) || (sign * TYPED_TRAIT(_compare)(temp->data, extreme_node->data) > 0)) {
+                extreme_node = temp;
+                extreme_bucket = iter;
+            }
+        }
+    }
+
+    return extreme_bucket;
+}
+
+TYPED_PARAM TYPED_FN(_get_max)(const TYPED_SET * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->size)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_rb_max_node)(ht->buckets[TYPED_FN(_extreme_bucket)(ht, 1)], ht->nil)->data;
+}
+
+TYPED_PARAM TYPED_FN(_get_min)(const TYPED_SET * const __restrict__ ht) {
+    if ((NULL == ht) || (NULL == ht->buckets) || (0 == ht->size)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_rb_min_node)(ht->buckets[TYPED_FN(_extreme_bucket)(ht, -1)], ht->nil)->data;
+}
+
+error_t TYPED_FN(_delete_max)(TYPED_SET * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_NODE **bucket = &ht->buckets[TYPED_FN(_extreme_bucket)(ht, 1)];
+
+    TYPED_FN(_delete_node)(ht, bucket, TYPED_FN(_rb_max_node)(*bucket, ht->nil));
+
+    return SCL_OK;
+}
+
+error_t TYPED_FN(_delete_min)(TYPED_SET * const __restrict__ ht) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    if (0 == ht->size) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_NODE **bucket = &ht->buckets[TYPED_FN(_extreme_bucket)(ht, -1)];
+
+    TYPED_FN(_delete_node)(ht, bucket, TYPED_FN(_rb_min_node)(*bucket, ht->nil));
+
+    return SCL_OK;
+}
+
+error_t TYPED_FN(_traverse_inorder)(const TYPED_SET * const __restrict__ ht, FILE *fout) {
+    if (NULL == ht) {
+        return SCL_NULL_HASH_TABLE;
+    }
+
+    if (NULL == ht->buckets) {
+        return SCL_NULL_HASH_ROOTS;
+    }
+
+    for (size_t iter = 0; iter < ht->capacity; ++iter) {
+        TYPED_FN(_rb_traverse_inorder)(ht->buckets[iter], ht->nil, fout);
+    }
+
+    fprintf(fout, "\n");
+
+    return SCL_OK;
+}
+
+#endif /* TYPED_SET_IMPLEMENTATION */
+
+#ifdef TYPED_SET_MAP
+#define TYPED_SET_NULL_ERROR SCL_NULL_HASH_TABLE
+#include "typed_map_template.h"
+#endif
+
+#undef TYPED_NODE_SIZE
+#undef TYPED_SET_NAME
+#undef TYPED_SET_TRAITS
+#undef TYPED_SET_MAP
@@ -0,0 +1,101 @@
+/**
+ * @file typed_map_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/*
+ * No include guard, included by the typed templates when TYPED_SET_MAP is defined.
+ * The including template provides TYPED_SET_NULL_ERROR and the static functions
+ * TYPED_FN(_lookup_node) and TYPED_FN(_insert_key), every returned pointer points
+ * inside a node and stays valid until the key is deleted from the map.
+ */
+
+#ifndef TYPED_SET_NULL_ERROR
+#error "typed_map_template.h is included by the typed templates only"
+#endif
+
+void*                   TYPED_FN(_get)                      (const TYPED_SET * const __restrict__ map, TYPED_PARAM key);
+error_t                 TYPED_FN(_put)                      (TYPED_SET * const __restrict__ map, TYPED_PARAM key, const void * const value);
+void*                   TYPED_FN(_get_or_insert)            (TYPED_SET * const __restrict__ map, TYPED_PARAM key, uint8_t * const inserted);
+void*                   TYPED_FN(_update_in_place)          (TYPED_SET * const __restrict__ map, TYPED_PARAM key, typed_map_update_func update, void *context);
+
+#ifdef TYPED_SET_IMPLEMENTATION
+
+void* TYPED_FN(_get)(const TYPED_SET * const __restrict__ map, TYPED_PARAM key) {
+    if (NULL == map) {
+        return NULL;
+    }
+
+    TYPED_NODE *node = TYPED_FN(_lookup_node)(map, key);
+
+    return (NULL != node) ? node->value : NULL;
+}
+
+error_t TYPED_FN(_put)(TYPED_SET * const __restrict__ map, TYPED_PARAM key, const void * const value) {
+    if (NULL == map) {
+        return TYPED_SET_NULL_ERROR;
+    }
+
+    uint8_t created = 0;
+    TYPED_NODE *node = TYPED_FN(_insert_key)(map, key, &created);
+
+    if (NULL == node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    if (NULL != value) {
+        memcpy(node->value, value, map->value_size);
+    }
+
+    return SCL_OK;
+}
+
+void* TYPED_FN(_get_or_insert)(TYPED_SET * const __restrict__ map, TYPED_PARAM key, uint8_t * const inserted) {
+    if (NULL == map) {
+        return NULL;
+    }
+
+    uint8_t created = 0;
+    TYPED_NODE *node = TYPED_FN(_insert_key)(map, key, &created);
+
+    if (NULL != inserted) {
+        *inserted = created;
+    }
+
+    return (NULL != node) ? node->value : NULL;
+}
+
+void* TYPED_FN(_update_in_place)(TYPED_SET * const __restrict__ map, TYPED_PARAM key, typed_map_update_func update, void *context) {
+    /* Missing keys start from a zeroed payload, so counters and sums need no separate insert */
+    void *value = TYPED_FN(_get_or_insert)(map, key, NULL);
+
+    if ((NULL != value) && (NULL != update)) {
+        update(value, context);
+    }
+
+    return value;
+}
+
+#endif /* TYPED_SET_IMPLEMENTATION */
+
+#undef TYPED_SET_NULL_ERROR
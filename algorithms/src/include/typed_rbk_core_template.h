@@ -0,0 +1,425 @@
+/**
+ * @file typed_rbk_core_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/* No include guard, the core is included once for every red-black instantiation */
+
+#include "typed_set_template.h"
+
+/**
+ * @brief Typed Red-Black Tree Node object definition, shared by
+ * the typed red-black trees and the buckets of the typed hash tables
+ * 
+ */
+typedef struct TYPED_FN(_node_s) {
+    TYPED_KEY data;                                             /* Key of the node */
+    struct TYPED_FN(_node_s) *parent;                           /* Pointer to parent node */
+    struct TYPED_FN(_node_s) *left;                             /* Pointer to left child node */
+    struct TYPED_FN(_node_s) *right;                            /* Pointer to right child node */
+    uint32_t count;                                             /* Number of nodes with the same data value */
+    uint32_t color;                                             /* Color of a node, TYPED_RED or TYPED_BLACK */
+#ifdef TYPED_SET_MAP
+    _Alignas(max_align_t) unsigned char value[];                /* Inline payload, sized by the owning map */
+#endif
+} TYPED_NODE;
+
+#ifdef TYPED_SET_IMPLEMENTATION
+
+/*
+ * The core works on a root pointer and a nil sentinel, so the same code
+ * balances the typed red-black trees and every bucket of the typed hash tables.
+ */
+
+static inline void TYPED_FN(_rb_rotate_left)(TYPED_NODE ** const root, const TYPED_NODE * const nil, TYPED_NODE * const fix_node) {
+    TYPED_NODE * const rotate_node = fix_node->right;
+
+    fix_node->right = rotate_node->left;
+
+    if (nil != rotate_node->left) {
+        rotate_node->left->parent = fix_node;
+    }
+
+    rotate_node->parent = fix_node->parent;
+
+    if (nil == fix_node->parent) {
+        *root = rotate_node;
+    } else if (fix_node->parent->left == fix_node) {
+        fix_node->parent->left = rotate_node;
+    } else {
+        fix_node->parent->right = rotate_node;
+    }
+
+    rotate_node->left = fix_node;
+    fix_node->parent = rotate_node;
+}
+
+static inline void TYPED_FN(_rb_rotate_right)(TYPED_NODE ** const root, const TYPED_NODE * const nil, TYPED_NODE * const fix_node) {
+    TYPED_NODE * const rotate_node = fix_node->left;
+
+    fix_node->left = rotate_node->right;
+
+    if (nil != rotate_node->right) {
+        rotate_node->right->parent = fix_node;
+    }
+
+    rotate_node->parent = fix_node->parent;
+
+    if (nil == fix_node->parent) {
+        *root = rotate_node;
+    } else if (fix_node->parent->right == fix_node) {
+        fix_node->parent->right = rotate_node;
+    } else {
+        fix_node->parent->left = rotate_node;
+    }
+
+    rotate_node->right = fix_node;
+    fix_node->parent = rotate_node;
+}
+
+static inline void TYPED_FN(_rb_insert_fixup)(TYPED_NODE ** const root, const TYPED_NODE * const nil, TYPED_NODE *fix_node) {
+    while (TYPED_RED == fix_node->parent->color) {
+        TYPED_NODE *parent = fix_node->parent;
+        TYPED_NODE *grandparent = parent->parent;
+
+        if (grandparent->left == parent) {
+            TYPED_NODE *uncle = grandparent->right;
+
+            if (TYPED_RED == uncle->color) {
+                parent->color = uncle->color = TYPED_BLACK;
+                grandparent->color = TYPED_RED;
+                fix_node = grandparent;
+            } else {
+                if (parent->right == fix_node) {
+                    fix_node = parent;
+                    TYPED_FN(_rb_rotate_left)(root, nil, fix_node);
+                    parent = fix_node->parent;
+                }
+
+                parent->color = TYPED_BLACK;
+                grandparent->color = TYPED_RED;
+                TYPED_FN(_rb_rotate_right)(root, nil, grandparent);
+            }
+        } else {
+            TYPED_NODE *uncle = grandparent->left;
+
+            if (TYPED_RED == uncle->color) {
+                parent->color = uncle->color = TYPED_BLACK;
+                grandparent->color = TYPED_RED;
+                fix_node = grandparent;
+            } else {
+                if (parent->left == fix_node) {
+                    fix_node = parent;
+                    TYPED_FN(_rb_rotate_right)(root, nil, fix_node);
+                    parent = fix_node->parent;
+                }
+
+                parent->color = TYPED_BLACK;
+                grandparent->color = TYPED_RED;
+                TYPED_FN(_rb_rotate_left)(root, nil, grandparent);
+            }
+        }
+    }
+
+    (*root)->color = TYPED_BLACK;
+}
+
+/*
+ * Links an allocated node under the root or returns the node that already
+ * holds the same key, in which case the new node is left untouched.
+ */
+static inline TYPED_NODE* TYPED_FN(_rb_link_node)(TYPED_NODE ** const root, TYPED_NODE * const nil, TYPED_NODE * const new_node) {
+    TYPED_NODE *iterator = *root;
+    TYPED_NODE *parent_iterator = nil;
+    int32_t compare = 0;
+
+    while (nil != iterator) {
+        parent_iterator = iterator;
+        compare = TYPED_TRAIT(_compare)(new_node->data, iterator->data);
+
+        if (compare < 0) {
+            iterator = iterator->left;
+        } else if (compare > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    new_node->parent = parent_iterator;
+    new_node->left = new_node->right = nil;
+    new_node->color = TYPED_RED;
+
+    if (nil == parent_iterator) {
+        *root = new_node;
+    } else if (compare < 0) {
+        parent_iterator->left = new_node;
+    } else {
+        parent_iterator->right = new_node;
+    }
+
+    TYPED_FN(_rb_insert_fixup)(root, nil, new_node);
+
+    return new_node;
+}
+
+/*
+ * Inserts a key under the root, returns the node holding the key, nil when
+ * the node allocation failed, and reports in *created whether a node of
+ * node_size bytes (payload included, zeroed) was created.
+ */
+static inline TYPED_NODE* TYPED_FN(_rb_insert)(TYPED_NODE ** const root, TYPED_NODE * const nil, TYPED_PARAM data, size_t node_size, uint8_t * const created) {
+    TYPED_NODE *iterator = *root;
+    TYPED_NODE *parent_iterator = nil;
+    int32_t compare = 0;
+
+    *created = 0;
+
+    while (nil != iterator) {
+        parent_iterator = iterator;
+        compare = TYPED_TRAIT(_compare)(data, iterator->data);
+
+        if (compare < 0) {
+            iterator = iterator->left;
+        } else if (compare > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    TYPED_NODE *new_node = malloc(node_size);
+
+    if ((NULL == new_node) || (0 == TYPED_TRAIT(_copy)(data, &new_node->data))) {
+        free(new_node);
+
+        errno = ENOMEM;
+        perror("Not enough memory for typed red-black node allocation");
+
+        return nil;
+    }
+
+#ifdef TYPED_SET_MAP
+    memset(new_node->value, 0, node_size - sizeof(*new_node));
+#endif
+
+    new_node->parent = parent_iterator;
+    new_node->left = new_node->right = nil;
+    new_node->count = 1;
+    new_node->color = TYPED_RED;
+
+    if (nil == parent_iterator) {
+        *root = new_node;
+    } else if (compare < 0) {
+        parent_iterator->left = new_node;
+    } else {
+        parent_iterator->right = new_node;
+    }
+
+    TYPED_FN(_rb_insert_fixup)(root, nil, new_node);
+
+    *created = 1;
+
+    return new_node;
+}
+
+static inline TYPED_NODE* TYPED_FN(_rb_find)(TYPED_NODE * const root, const TYPED_NODE * const nil, TYPED_PARAM data) {
+    TYPED_NODE *iterator = root;
+
+    while (nil != iterator) {
+        int32_t compare = TYPED_TRAIT(_compare)(data, iterator->data);
+
+        if (compare < 0) {
+            iterator = iterator->left;
+        } else if (compare > 0) {
+            iterator = iterator->right;
+        } else {
+            return iterator;
+        }
+    }
+
+    return iterator;
+}
+
+static inline TYPED_NODE* TYPED_FN(_rb_min_node)(TYPED_NODE *root, const TYPED_NODE * const nil) {
+    if (nil != root) {
+        while (nil != root->left) {
+            root = root->left;
+        }
+    }
+
+    return root;
+}
+
+static inline TYPED_NODE* TYPED_FN(_rb_max_node)(TYPED_NODE *root, const TYPED_NODE * const nil) {
+    if (nil != root) {
+        while (nil != root->right) {
+            root = root->right;
+        }
+    }
+
+    return root;
+}
+
+static inline void TYPED_FN(_rb_transplant)(TYPED_NODE ** const root, TYPED_NODE * const nil, TYPED_NODE * const old_node, TYPED_NODE * const new_node) {
+    if (nil == old_node->parent) {
+        *root = new_node;
+    } else if (old_node->parent->left == old_node) {
+        old_node->parent->left = new_node;
+    } else {
+        old_node->parent->right = new_node;
+    }
+
+    /* The sentinel parent is written on purpose, the delete fixup starts from it */
+    new_node->parent = old_node->parent;
+}
+
+static inline void TYPED_FN(_rb_delete_fixup)(TYPED_NODE ** const root, TYPED_NODE * const nil, TYPED_NODE *fix_node) {
+    while ((*root != fix_node) && (TYPED_BLACK == fix_node->color)) {
+        TYPED_NODE *parent = fix_node->parent;
+
+        if (parent->left == fix_node) {
+            TYPED_NODE *sibling = parent->right;
+
+            if (TYPED_RED == sibling->color) {
+                sibling->color = TYPED_BLACK;
+                parent->color = TYPED_RED;
+                TYPED_FN(_rb_rotate_left)(root, nil, parent);
+                sibling = parent->right;
+            }
+
+            if ((TYPED_BLACK == sibling->left->color) && (TYPED_BLACK == sibling->right->color)) {
+                sibling->color = TYPED_RED;
+                fix_node = parent;
+            } else {
+                if (TYPED_BLACK == sibling->right->color) {
+                    sibling->left->color = TYPED_BLACK;
+                    sibling->color = TYPED_RED;
+                    TYPED_FN(_rb_rotate_right)(root, nil, sibling);
+                    sibling = parent->right;
+                }
+
+                sibling->color = parent->color;
+                parent->color = TYPED_BLACK;
+                sibling->right->color = TYPED_BLACK;
+                TYPED_FN(_rb_rotate_left)(root, nil, parent);
+                fix_node = *root;
+            }
+        } else {
+            TYPED_NODE *sibling = parent->left;
+
+            if (TYPED_RED == sibling->color) {
+                sibling->color = TYPED_BLACK;
+                parent->color = TYPED_RED;
+                TYPED_FN(_rb_rotate_right)(root, nil, parent);
+                sibling = parent->left;
+            }
+
+            if ((TYPED_BLACK == sibling->left->color) && (TYPED_BLACK == sibling->right->color)) {
+                sibling->color = TYPED_RED;
+                fix_node = parent;
+            } else {
+                if (TYPED_BLACK == sibling->left->color) {
+                    sibling->right->color = TYPED_BLACK;
+                    sibling->color = TYPED_RED;
+                    TYPED_FN(_rb_rotate_left)(root, nil, sibling);
+                    sibling = parent->left;
+                }
+
+                sibling->color = parent->color;
+                parent->color = TYPED_BLACK;
+                sibling->left->color = TYPED_BLACK;
+                TYPED_FN(_rb_rotate_right)(root, nil, parent);
+                fix_node = *root;
+            }
+        }
+    }
+
+    fix_node->color = TYPED_BLACK;
+}
+
+/*
+ * Unlinks a node from the tree without releasing it, the caller owns the node afterwards.
+ */
+static inline void TYPED_FN(_rb_unlink_node)(TYPED_NODE ** const root, TYPED_NODE * const nil, TYPED_NODE * const delete_node) {
+    TYPED_NODE *moved_node = delete_node;
+    TYPED_NODE *fix_node = nil;
+    uint32_t moved_color = moved_node->color;
+
+    if (nil == delete_node->left) {
+        fix_node = delete_node->right;
+        TYPED_FN(_rb_transplant)(root, nil, delete_node, delete_node->right);
+    } else if (nil == delete_node->right) {
+        fix_node = delete_node->left;
+        TYPED_FN(_rb_transplant)(root, nil, delete_node, delete_node->left);
+    } else {
+        moved_node = TYPED_FN(_rb_min_node)(delete_node->right, nil);
+        moved_color = moved_node->color;
+        fix_node = moved_node->right;
+
+        if (moved_node->parent == delete_node) {
+            fix_node->parent = moved_node;
+        } else {
+            TYPED_FN(_rb_transplant)(root, nil, moved_node, moved_node->right);
+            moved_node->right = delete_node->right;
+            moved_node->right->parent = moved_node;
+        }
+
+        TYPED_FN(_rb_transplant)(root, nil, delete_node, moved_node);
+        moved_node->left = delete_node->left;
+        moved_node->left->parent = moved_node;
+        moved_node->color = delete_node->color;
+    }
+
+    if (TYPED_BLACK == moved_color) {
+        TYPED_FN(_rb_delete_fixup)(root, nil, fix_node);
+    }
+
+    /* Leave the sentinel as it was found, the transplants and the fixup may touch it */
+    nil->parent = nil->left = nil->right = nil;
+    nil->color = TYPED_BLACK;
+}
+
+static inline void TYPED_FN(_rb_free_nodes)(TYPED_NODE * const root, const TYPED_NODE * const nil) {
+    if (nil == root) {
+        return;
+    }
+
+    TYPED_FN(_rb_free_nodes)(root->left, nil);
+    TYPED_FN(_rb_free_nodes)(root->right, nil);
+
+    TYPED_TRAIT(_release)(root->data);
+    free(root);
+}
+
+static inline void TYPED_FN(_rb_traverse_inorder)(const TYPED_NODE * const root, const TYPED_NODE * const nil, FILE *fout) {
+    if (nil == root) {
+        return;
+    }
+
+    TYPED_FN(_rb_traverse_inorder)(root->left, nil, fout);
+    TYPED_TRAIT(_print)(fout, root->data);
+    TYPED_FN(_rb_traverse_inorder)(root->right, nil, fout);
+}
+
+#endif /* TYPED_SET_IMPLEMENTATION */
@@ -0,0 +1,306 @@
+/**
+ * @file typed_red_black_tree_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/* No include guard, the template is included once for every instantiation */
+
+#if !defined(TYPED_SET_NAME) || !defined(TYPED_SET_TRAITS)
+#error "TYPED_SET_NAME and TYPED_SET_TRAITS must be defined before including typed_red_black_tree_template.h"
+#endif
+
+#include "typed_rbk_core_template.h"
+
+/**
+ * @brief Typed Red-Black Tree object definition
+ * 
+ */
+typedef struct TYPED_FN(_s) {
+    TYPED_NODE *root;                                           /* Pointer to tree root */
+    TYPED_NODE *nil;                                            /* Black hole pointer */
+    size_t size;                                                /* Size of the red-black tree */
+#ifdef TYPED_SET_MAP
+    size_t value_size;                                          /* Size of the payload stored in every node */
+#endif
+} TYPED_SET;
+
+#ifdef TYPED_SET_MAP
+#define TYPED_NODE_SIZE(SET) (sizeof(TYPED_NODE) + (SET)->value_size)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (size_t value_size);
+#else
+#define TYPED_NODE_SIZE(SET) sizeof(TYPED_NODE)
+TYPED_SET*              TYPED_PREFIX_FN(create_, )          (void);
+#endif
+error_t                 TYPED_PREFIX_FN(free_, )            (TYPED_SET * const __restrict__ tree);
+
+#ifndef TYPED_SET_MAP
+error_t                 TYPED_FN(_insert)                   (TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+error_t                 TYPED_FN(_modify_data)              (TYPED_SET * const __restrict__ tree, TYPED_PARAM old_data, TYPED_PARAM new_data);
+#endif
+error_t                 TYPED_FN(_delete)                   (TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+
+uint8_t                 TYPED_PREFIX_FN(is_, _empty)        (const TYPED_SET * const __restrict__ tree);
+size_t                  TYPED_PREFIX_FN(get_, _size)        (const TYPED_SET * const __restrict__ tree);
+uint8_t                 TYPED_FN(_includes)                 (const TYPED_SET * const __restrict__ tree, TYPED_PARAM data);
+
+TYPED_PARAM             TYPED_FN(_max_data)                 (const TYPED_SET * const __restrict__ tree);
+TYPED_PARAM             TYPED_FN(_min_data)                 (const TYPED_SET * const __restrict__ tree);
+error_t                 TYPED_FN(_delete_max)               (TYPED_SET * const __restrict__ tree);
+error_t                 TYPED_FN(_delete_min)               (TYPED_SET * const __restrict__ tree);
+
+error_t                 TYPED_FN(_traverse_inorder)         (const TYPED_SET * const __restrict__ tree, FILE *fout);
+
+#ifdef TYPED_SET_IMPLEMENTATION
+
+#ifdef TYPED_SET_MAP
+TYPED_SET* TYPED_PREFIX_FN(create_, )(size_t value_size) {
+#else
+TYPED_SET* TYPED_PREFIX_FN(create_, )(void) {
+#endif
+    TYPED_SET *new_tree = malloc(sizeof(*new_tree));
+
+    if (NULL != new_tree) {
+        new_tree->nil = calloc(1, sizeof(*new_tree->nil));
+
+        if (NULL != new_tree->nil) {
+            new_tree->nil->parent = new_tree->nil->left = new_tree->nil->right = new_tree->nil;
+            new_tree->nil->color = TYPED_BLACK;
+        } else {
+            free(new_tree);
+            new_tree = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for nil typed red-black allocation");
+
+            return NULL;
+        }
+
+        new_tree->root = new_tree->nil;
+        new_tree->size = 0;
+#ifdef TYPED_SET_MAP
+        new_tree->value_size = value_size;
+#endif
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for typed red-black allocation");
+    }
+
+    return new_tree;
+}
+
+error_t TYPED_PREFIX_FN(free_, )(TYPED_SET * const __restrict__ tree) {
+    if (NULL != tree) {
+        TYPED_FN(_rb_free_nodes)(tree->root, tree->nil);
+
+        free(tree->nil);
+        tree->nil = NULL;
+        free(tree);
+
+        return SCL_OK;
+    }
+
+    return SCL_NULL_RBK;
+}
+
+/*
+ * Returns the node holding the key, creating it when the key is missing,
+ * and NULL when the node allocation failed.
+ */
+static TYPED_NODE* TYPED_FN(_insert_key)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data, uint8_t * const created) {
+    TYPED_NODE *node = TYPED_FN(_rb_insert)(&tree->root, tree->nil, data, TYPED_NODE_SIZE(tree), created);
+
+    if (tree->nil == node) {
+        return NULL;
+    }
+
+    tree->size += *created;
+
+    return node;
+}
+
+static inline TYPED_NODE* TYPED_FN(_lookup_node)(const TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    TYPED_NODE *node = TYPED_FN(_rb_find)(tree->root, tree->nil, data);
+
+    return (tree->nil != node) ? node : NULL;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_insert)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    uint8_t created = 0;
+    TYPED_NODE *node = TYPED_FN(_insert_key)(tree, data, &created);
+
+    if (NULL == node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    if (0 == created) {
+        ++(node->count);
+    }
+
+    return SCL_OK;
+}
+#endif
+
+static void TYPED_FN(_delete_node)(TYPED_SET * const __restrict__ tree, TYPED_NODE * const delete_node) {
+    TYPED_FN(_rb_unlink_node)(&tree->root, tree->nil, delete_node);
+
+    TYPED_TRAIT(_release)(delete_node->data);
+    free(delete_node);
+
+    --(tree->size);
+}
+
+error_t TYPED_FN(_delete)(TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_NODE *delete_node = TYPED_FN(_rb_find)(tree->root, tree->nil, data);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    TYPED_FN(_delete_node)(tree, delete_node);
+
+    return SCL_OK;
+}
+
+#ifndef TYPED_SET_MAP
+error_t TYPED_FN(_modify_data)(TYPED_SET * const __restrict__ tree, TYPED_PARAM old_data, TYPED_PARAM new_data) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    error_t err = TYPED_FN(_delete)(tree, old_data);
+
+    if (SCL_OK != err) {
+        return err;
+    }
+
+    return TYPED_FN(_insert)(tree, new_data);
+}
+#endif
+
+uint8_t TYPED_PREFIX_FN(is_, _empty)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root) || (0 == tree->size)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+size_t TYPED_PREFIX_FN(get_, _size)(const TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SIZE_MAX;
+    }
+
+    return tree->size;
+}
+
+uint8_t TYPED_FN(_includes)(const TYPED_SET * const __restrict__ tree, TYPED_PARAM data) {
+    if (NULL == tree) {
+        return 0;
+    }
+
+    return (tree->nil != TYPED_FN(_rb_find)(tree->root, tree->nil, data));
+}
+
+TYPED_PARAM TYPED_FN(_max_data)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_rb_max_node)(tree->root, tree->nil)->data;
+}
+
+TYPED_PARAM TYPED_FN(_min_data)(const TYPED_SET * const __restrict__ tree) {
+    if ((NULL == tree) || (tree->nil == tree->root)) {
+        return TYPED_TRAIT(_none)();
+    }
+
+    return TYPED_FN(_rb_min_node)(tree->root, tree->nil)->data;
+}
+
+error_t TYPED_FN(_delete_max)(TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_FN(_delete_node)(tree, TYPED_FN(_rb_max_node)(tree->root, tree->nil));
+
+    return SCL_OK;
+}
+
+error_t TYPED_FN(_delete_min)(TYPED_SET * const __restrict__ tree) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    TYPED_FN(_delete_node)(tree, TYPED_FN(_rb_min_node)(tree->root, tree->nil));
+
+    return SCL_OK;
+}
+
+error_t TYPED_FN(_traverse_inorder)(const TYPED_SET * const __restrict__ tree, FILE *fout) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        fprintf(fout, "(Null)\n");
+    } else {
+        TYPED_FN(_rb_traverse_inorder)(tree->root, tree->nil, fout);
+        fprintf(fout, "\n");
+    }
+
+    return SCL_OK;
+}
+
+#endif /* TYPED_SET_IMPLEMENTATION */
+
+#ifdef TYPED_SET_MAP
+#define TYPED_SET_NULL_ERROR SCL_NULL_RBK
+#include "typed_map_template.h"
+#endif
+
+#undef TYPED_NODE_SIZE
+#undef TYPED_SET_NAME
+#undef TYPED_SET_TRAITS
+#undef TYPED_SET_MAP
@@ -0,0 +1,218 @@
+/**
+ * @file typed_set_template.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#ifndef TYPED_SET_TEMPLATE_UTILS_H_
+#define TYPED_SET_TEMPLATE_UTILS_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <errno.h>
+#include "config.h"
+
+/**
+ * @brief Helpers shared by the typed templates. A template is instantiated by
+ * defining TYPED_SET_NAME (prefix of every type and function) and TYPED_SET_TRAITS
+ * (prefix of the key traits below) and then including the template header, which
+ * emits the types and prototypes, and the definitions too when TYPED_SET_IMPLEMENTATION
+ * is defined. The key traits are static inline functions, so every comparison and
+ * hash is inlined into the typed copy instead of going through a function pointer.
+ * 
+ * A traits prefix T must provide:
+ *  T_key_t, T_param_t                  - stored key type and the type keys are passed as
+ *  T_compare(T_param_t, T_param_t)     - three way comparison
+ *  T_hash(T_param_t)                   - hash of a key, used by the hash tables
+ *  T_copy(T_param_t, T_key_t *)        - stores a key in a node, returns 0 on failure
+ *  T_release(T_key_t)                  - releases a key stored in a node
+ *  T_none(void)                        - key returned by min/max of an empty set
+ *  T_print(FILE *, T_param_t)          - prints a key followed by a space
+ * 
+ * Defining TYPED_SET_MAP as well turns the instantiation into a map, every
+ * node then carries a value_size bytes payload right after the key fields and
+ * the insert/modify functions are replaced by the typed_map_template.h ones.
+ * 
+ */
+#define TYPED_CONCAT_HELPER(A, B)                   A##B
+#define TYPED_CONCAT(A, B)                          TYPED_CONCAT_HELPER(A, B)
+
+#define TYPED_FN(SUFFIX)                            TYPED_CONCAT(TYPED_SET_NAME, SUFFIX)
+#define TYPED_PREFIX_FN(PREFIX, SUFFIX)             TYPED_CONCAT(TYPED_CONCAT(PREFIX, TYPED_SET_NAME), SUFFIX)
+#define TYPED_TRAIT(SUFFIX)                         TYPED_CONCAT(TYPED_SET_TRAITS, SUFFIX)
+#define TYPED_KEY                                   TYPED_TRAIT(_key_t)
+#define TYPED_PARAM                                 TYPED_TRAIT(_param_t)
+#define TYPED_SET                                   TYPED_FN(_t)
+#define TYPED_NODE                                  TYPED_FN(_node_t)
+
+/**
+ * @brief Callback used by the typed maps to update a payload in place
+ * 
+ */
+typedef void (*typed_map_update_func)(void *value, void *context);
+
+#define TYPED_RED                                   0
+#define TYPED_BLACK                                 1
+
+static inline size_t typed_mix_hash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+
+    return (size_t)hash;
+}
+
+/* int32_t keys only back the maps, the int32_t sets are the hand-written engines */
+typedef int32_t                                     typed_i32_key_t;
+typedef int32_t                                     typed_i32_param_t;
+
+static inline int32_t typed_i32_compare(int32_t left, int32_t right) {
+    return (left > right) - (left < right);
+}
+
+static inline size_t typed_i32_hash(int32_t key) {
+    return typed_mix_hash((uint64_t)(uint32_t)key);
+}
+
+static inline uint8_t typed_i32_copy(int32_t key, int32_t * const dest) {
+    *dest = key;
+    return 1;
+}
+
+static inline void typed_i32_release(int32_t key) {
+    (void)key;
+}
+
+static inline int32_t typed_i32_none(void) {
+    return INT32_MIN;
+}
+
+static inline void typed_i32_print(FILE *fout, int32_t key) {
+    fprintf(fout, "%" PRId32 " ", key);
+}
+
+typedef int64_t                                     typed_i64_key_t;
+typedef int64_t                                     typed_i64_param_t;
+
+static inline int32_t typed_i64_compare(int64_t left, int64_t right) {
+    return (left > right) - (left < right);
+}
+
+static inline size_t typed_i64_hash(int64_t key) {
+    return typed_mix_hash((uint64_t)key);
+}
+
+static inline uint8_t typed_i64_copy(int64_t key, int64_t * const dest) {
+    *dest = key;
+    return 1;
+}
+
+static inline void typed_i64_release(int64_t key) {
+    (void)key;
+}
+
+static inline int64_t typed_i64_none(void) {
+    return INT64_MIN;
+}
+
+static inline void typed_i64_print(FILE *fout, int64_t key) {
+    fprintf(fout, "%" PRId64 " ", key);
+}
+
+typedef uint32_t                                    typed_u32_key_t;
+typedef uint32_t                                    typed_u32_param_t;
+
+static inline int32_t typed_u32_compare(uint32_t left, uint32_t right) {
+    return (left > right) - (left < right);
+}
+
+static inline size_t typed_u32_hash(uint32_t key) {
+    return typed_mix_hash(key);
+}
+
+static inline uint8_t typed_u32_copy(uint32_t key, uint32_t * const dest) {
+    *dest = key;
+    return 1;
+}
+
+static inline void typed_u32_release(uint32_t key) {
+    (void)key;
+}
+
+static inline uint32_t typed_u32_none(void) {
+    return 0;
+}
+
+static inline void typed_u32_print(FILE *fout, uint32_t key) {
+    fprintf(fout, "%" PRIu32 " ", key);
+}
+
+typedef char*                                       typed_str_key_t;
+typedef const char*                                 typed_str_param_t;
+
+static inline int32_t typed_str_compare(const char *left, const char *right) {
+    return strcmp(left, right);
+}
+
+static inline size_t typed_str_hash(const char *key) {
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    while ('\0' != *key) {
+        hash ^= (uint8_t)*key++;
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    return typed_mix_hash(hash);
+}
+
+static inline uint8_t typed_str_copy(const char *key, char ** const dest) {
+    size_t length = strlen(key) + 1;
+
+    *dest = malloc(length);
+
+    if (NULL == *dest) {
+        return 0;
+    }
+
+    memcpy(*dest, key, length);
+
+    return 1;
+}
+
+static inline void typed_str_release(char *key) {
+    free(key);
+}
+
+static inline const char* typed_str_none(void) {
+    return NULL;
+}
+
+static inline void typed_str_print(FILE *fout, const char *key) {
+    fprintf(fout, "%s ", key);
+}
+
+#endif /* TYPED_SET_TEMPLATE_UTILS_H_ */
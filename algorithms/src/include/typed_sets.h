@@ -0,0 +1,98 @@
+/**
+ * @file typed_sets.h
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#ifndef TYPED_SETS_UTILS_H_
+#define TYPED_SETS_UTILS_H_
+
+/*
+ * Type specialized copies of the set engines, every block below stamps out
+ * one engine for one key type, so keys are stored by value (or as an owned
+ * string) and compared and hashed without any function pointer or void*.
+ *
+ * There is no int32_t set on purpose. The hand-written avl_tree, red_black_tree
+ * and hash_table_linked engines are the int32_t sets: they carry what the
+ * templates leave out (finger inserts, batched and prefetched lookups, in place
+ * modify, the membership filter, memory accounting, set_ops_t registration and
+ * the user hash of the drivers) and their outputs are the reference ones, so an
+ * int32_t instantiation would only be a second, slower copy of them.
+ */
+
+#define TYPED_SET_NAME avl_i64
+#define TYPED_SET_TRAITS typed_i64
+#include "typed_avl_tree_template.h"
+
+#define TYPED_SET_NAME avl_u32
+#define TYPED_SET_TRAITS typed_u32
+#include "typed_avl_tree_template.h"
+
+#define TYPED_SET_NAME avl_str
+#define TYPED_SET_TRAITS typed_str
+#include "typed_avl_tree_template.h"
+
+#define TYPED_SET_NAME rbk_i64
+#define TYPED_SET_TRAITS typed_i64
+#include "typed_red_black_tree_template.h"
+
+#define TYPED_SET_NAME rbk_u32
+#define TYPED_SET_TRAITS typed_u32
+#include "typed_red_black_tree_template.h"
+
+#define TYPED_SET_NAME rbk_str
+#define TYPED_SET_TRAITS typed_str
+#include "typed_red_black_tree_template.h"
+
+#define TYPED_SET_NAME hash_table_i64
+#define TYPED_SET_TRAITS typed_i64
+#include "typed_hash_table_template.h"
+
+#define TYPED_SET_NAME hash_table_u32
+#define TYPED_SET_TRAITS typed_u32
+#include "typed_hash_table_template.h"
+
+#define TYPED_SET_NAME hash_table_str
+#define TYPED_SET_TRAITS typed_str
+#include "typed_hash_table_template.h"
+
+/*
+ * Key to value maps, the payload size is chosen at creation and the
+ * payload is stored inline in the node, next to the key.
+ */
+
+#define TYPED_SET_NAME avl_map
+#define TYPED_SET_TRAITS typed_i32
+#define TYPED_SET_MAP
+#include "typed_avl_tree_template.h"
+
+#define TYPED_SET_NAME rbk_map
+#define TYPED_SET_TRAITS typed_i32
+#define TYPED_SET_MAP
+#include "typed_red_black_tree_template.h"
+
+#define TYPED_SET_NAME hash_table_map
+#define TYPED_SET_TRAITS typed_i32
+#define TYPED_SET_MAP
+#include "typed_hash_table_template.h"
+
+#endif /* TYPED_SETS_UTILS_H_ */
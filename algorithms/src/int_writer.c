@@ -0,0 +1,277 @@
+/**
+ * @file int_writer.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#include "./include/int_writer.h"
+#include <sys/types.h>
+#include <sys/uio.h>
+
+/* "00" "01" ... "99", two digits are produced by one division and one copy */
+static const char int_writer_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static uint32_t int_writer_count_digits(uint32_t value) {
+    /* Independent comparisons, compiled to flag additions instead of a chain of branches */
+    return 1 + (value >= 10) + (value >= 100) + (value >= 1000) + (value >= 10000) +
+           (value >= 100000) + (value >= 1000000) + (value >= 10000000) +
+           (value >= 100000000) + (value >= 1000000000);
+}
+
+size_t int_writer_format(int32_t key, char * const dest) {
+    size_t length = 0;
+    uint32_t value = (uint32_t)key;
+
+    if (key < 0) {
+        dest[length++] = '-';
+        value = 0U - value;
+    }
+
+    length += int_writer_count_digits(value);
+
+    char *digit = dest + length;
+
+    while (value >= 100) {
+        uint32_t pair = (value % 100) * 2;
+
+        value /= 100;
+        digit -= 2;
+        memcpy(digit, &int_writer_digit_pairs[pair], 2);
+    }
+
+    if (value >= 10) {
+        memcpy(digit - 2, &int_writer_digit_pairs[value * 2], 2);
+    } else {
+        *(digit - 1) = (char)('0' + value);
+    }
+
+    return length;
+}
+
+static int_writer_t* create_int_writer_helper(int fd, FILE *fout, size_t capacity) {
+    /* A whole batch of staged keys must fit in the buffer */
+    if (capacity < INT_WRITER_PENDING_KEYS * INT_WRITER_MAX_DIGITS) {
+        capacity = INT_WRITER_BUFFER_SIZE;
+    }
+
+    int_writer_t *new_writer = malloc(sizeof(*new_writer));
+
+    if (NULL != new_writer) {
+        new_writer->length = 0;
+        new_writer->capacity = capacity;
+        new_writer->fd = fd;
+        new_writer->stream = fout;
+        new_writer->status = SCL_OK;
+        new_writer->pending_length = 0;
+
+        new_writer->buffer = malloc(capacity);
+
+        if (NULL == new_writer->buffer) {
+            free(new_writer);
+            new_writer = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for buffer of integer writer");
+        }
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for integer writer allocation");
+    }
+
+    return new_writer;
+}
+
+int_writer_t* create_int_writer(int fd, size_t capacity) {
+    if (fd < 0) {
+        return NULL;
+    }
+
+    return create_int_writer_helper(fd, NULL, capacity);
+}
+
+int_writer_t* create_int_writer_stream(FILE *fout, size_t capacity) {
+    if (NULL == fout) {
+        return NULL;
+    }
+
+    /* Whatever the stream buffered so far must reach the descriptor before our output */
+    if (0 != fflush(fout)) {
+        return NULL;
+    }
+
+    return create_int_writer_helper(fileno(fout), fout, capacity);
+}
+
+static error_t int_writer_write_all(int_writer_t * const __restrict__ writer, struct iovec *chunks, int chunks_count) {
+    if (writer->fd < 0) {
+        for (int iter = 0; iter < chunks_count; ++iter) {
+            if (fwrite(chunks[iter].iov_base, 1, chunks[iter].iov_len, writer->stream) != chunks[iter].iov_len) {
+                return SCL_WRITE_FAILED;
+            }
+        }
+
+        return SCL_OK;
+    }
+
+    while (chunks_count > 0) {
+        ssize_t written = writev(writer->fd, chunks, chunks_count);
+
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+
+            return SCL_WRITE_FAILED;
+        }
+
+        /* Short write, skip the chunks that made it and retry with the rest */
+        size_t remaining = (size_t)written;
+
+        while ((chunks_count > 0) && (remaining >= chunks->iov_len)) {
+            remaining -= chunks->iov_len;
+            ++chunks;
+            --chunks_count;
+        }
+
+        if (chunks_count > 0) {
+            chunks->iov_base = (char *)chunks->iov_base + remaining;
+            chunks->iov_len -= remaining;
+        }
+    }
+
+    return SCL_OK;
+}
+
+static void int_writer_write_buffer(int_writer_t * const __restrict__ writer) {
+    if ((SCL_OK == writer->status) && (0 != writer->length)) {
+        struct iovec chunk = { .iov_base = writer->buffer, .iov_len = writer->length };
+
+        writer->status = int_writer_write_all(writer, &chunk, 1);
+    }
+
+    writer->length = 0;
+}
+
+static void int_writer_format_pending(int_writer_t * const __restrict__ writer) {
+    if (writer->capacity - writer->length < writer->pending_length * INT_WRITER_MAX_DIGITS) {
+        int_writer_write_buffer(writer);
+    }
+
+    char *dest = writer->buffer + writer->length;
+
+    for (size_t iter = 0; iter < writer->pending_length; ++iter) {
+        dest += int_writer_format(writer->pending[iter], dest);
+        *dest++ = ' ';
+    }
+
+    writer->length = (size_t)(dest - writer->buffer);
+    writer->pending_length = 0;
+}
+
+error_t int_writer_flush(int_writer_t * const __restrict__ writer) {
+    if (NULL == writer) {
+        return SCL_NULL_INT_WRITER;
+    }
+
+    int_writer_format_pending(writer);
+    int_writer_write_buffer(writer);
+
+    return writer->status;
+}
+
+error_t free_int_writer(int_writer_t * const __restrict__ writer) {
+    if (NULL == writer) {
+        return SCL_NULL_INT_WRITER;
+    }
+
+    error_t err = int_writer_flush(writer);
+
+    if ((NULL != writer->stream) && (writer->fd >= 0)) {
+        /* Hand the descriptor back to the stream at the position we left it */
+        off_t position = lseek(writer->fd, 0, SEEK_CUR);
+
+        if (position >= 0) {
+            fseeko(writer->stream, position, SEEK_SET);
+        }
+    }
+
+    free(writer->buffer);
+    free(writer);
+
+    return err;
+}
+
+error_t int_writer_put_bytes(int_writer_t * const __restrict__ writer, const char *bytes, size_t length) {
+    if (NULL == writer) {
+        return SCL_NULL_INT_WRITER;
+    }
+
+    int_writer_format_pending(writer);
+
+    if (writer->capacity - writer->length >= length) {
+        memcpy(writer->buffer + writer->length, bytes, length);
+        writer->length += length;
+
+        return writer->status;
+    }
+
+    /* Larger than the free space, the pending output and the bytes leave in one call */
+    if (SCL_OK == writer->status) {
+        struct iovec chunks[2] = {
+            { .iov_base = writer->buffer, .iov_len = writer->length },
+            { .iov_base = (void *)bytes, .iov_len = length },
+        };
+
+        writer->status = int_writer_write_all(writer, chunks, 2);
+    }
+
+    writer->length = 0;
+
+    return writer->status;
+}
+
+error_t int_writer_put_int(int_writer_t * const __restrict__ writer, int32_t key) {
+    if (NULL == writer) {
+        return SCL_NULL_INT_WRITER;
+    }
+
+    writer->pending[writer->pending_length++] = key;
+
+    if (INT_WRITER_PENDING_KEYS == writer->pending_length) {
+        int_writer_format_pending(writer);
+    }
+
+    return writer->status;
+}
+
+void int_writer_visit(int32_t key, void *context) {
+    int_writer_put_int(context, key);
+}
@@ -0,0 +1,226 @@
+/**
+ * @file membership_filter.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+#include "./include/membership_filter.h"
+
+#define DEFAULT_FILTER_KEYS 1024
+#define DEFAULT_FILTER_COUNTERS_PER_KEY 12
+
+#define FILTER_COUNTERS_PER_WORD 16
+#define FILTER_COUNTERS_PER_BLOCK (FILTER_BLOCK_WORDS * FILTER_COUNTERS_PER_WORD)
+#define FILTER_COUNTER_MAX 15
+
+static uint64_t membership_filter_mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+static uint64_t* membership_filter_block(const membership_filter_t * const __restrict__ filter, uint64_t hash) {
+    /* Counters take the low 42 bits of the hash, the block index is derived independently */
+    return &filter->blocks[((size_t)membership_filter_mix(hash ^ UINT64_C(0x9e3779b97f4a7c15)) & filter->block_mask) * FILTER_BLOCK_WORDS];
+}
+
+membership_filter_t* create_membership_filter(size_t expected_keys) {
+    if (0 == expected_keys) {
+        expected_keys = DEFAULT_FILTER_KEYS;
+    }
+
+    size_t block_count = 1;
+
+    while (block_count * FILTER_COUNTERS_PER_BLOCK < expected_keys * DEFAULT_FILTER_COUNTERS_PER_KEY) {
+        block_count *= 2;
+    }
+
+    membership_filter_t *new_filter = malloc(sizeof(*new_filter));
+
+    if (NULL != new_filter) {
+        new_filter->block_mask = block_count - 1;
+        memset(&new_filter->stats, 0, sizeof(new_filter->stats));
+
+        new_filter->blocks = aligned_alloc(FILTER_BLOCK_WORDS * sizeof(uint64_t), block_count * FILTER_BLOCK_WORDS * sizeof(uint64_t));
+
+        if (NULL != new_filter->blocks) {
+            memset(new_filter->blocks, 0, block_count * FILTER_BLOCK_WORDS * sizeof(uint64_t));
+        } else {
+            free(new_filter);
+            new_filter = NULL;
+
+            errno = ENOMEM;
+            perror("Not enough memory for blocks of membership filter");
+        }
+    } else {
+        errno = ENOMEM;
+        perror("Not enough memory for membership filter allocation");
+    }
+
+    return new_filter;
+}
+
+error_t free_membership_filter(membership_filter_t * const __restrict__ filter) {
+    if (NULL != filter) {
+        free(filter->blocks);
+        filter->blocks = NULL;
+
+        free(filter);
+
+        return SCL_OK;
+    }
+
+    return SCL_NULL_MEMBERSHIP_FILTER;
+}
+
+error_t membership_filter_clear(membership_filter_t * const __restrict__ filter) {
+    if (NULL == filter) {
+        return SCL_NULL_MEMBERSHIP_FILTER;
+    }
+
+    memset(filter->blocks, 0, (filter->block_mask + 1) * FILTER_BLOCK_WORDS * sizeof(uint64_t));
+    memset(&filter->stats, 0, sizeof(filter->stats));
+
+    return SCL_OK;
+}
+
+error_t membership_filter_insert(membership_filter_t * const __restrict__ filter, int32_t key) {
+    if (NULL == filter) {
+        return SCL_NULL_MEMBERSHIP_FILTER;
+    }
+
+    uint64_t hash = membership_filter_mix((uint64_t)(uint32_t)key);
+    uint64_t *block = membership_filter_block(filter, hash);
+
+    for (int32_t probe = 0; probe < FILTER_HASH_PROBES; ++probe) {
+        uint32_t counter = (uint32_t)(hash >> (7 * probe)) & (FILTER_COUNTERS_PER_BLOCK - 1);
+        uint32_t shift = (counter % FILTER_COUNTERS_PER_WORD) * 4;
+        uint64_t *word = &block[counter / FILTER_COUNTERS_PER_WORD];
+
+        /* Saturated counters stick, a later delete cannot tell how many keys share them */
+        if (FILTER_COUNTER_MAX != ((*word >> shift) & FILTER_COUNTER_MAX)) {
+            *word += UINT64_C(1) << shift;
+        }
+    }
+
+    return SCL_OK;
+}
+
+error_t membership_filter_delete(membership_filter_t * const __restrict__ filter, int32_t key) {
+    if (NULL == filter) {
+        return SCL_NULL_MEMBERSHIP_FILTER;
+    }
+
+    uint64_t hash = membership_filter_mix((uint64_t)(uint32_t)key);
+    uint64_t *block = membership_filter_block(filter, hash);
+
+    for (int32_t probe = 0; probe < FILTER_HASH_PROBES; ++probe) {
+        uint32_t counter = (uint32_t)(hash >> (7 * probe)) & (FILTER_COUNTERS_PER_BLOCK - 1);
+        uint32_t shift = (counter % FILTER_COUNTERS_PER_WORD) * 4;
+        uint64_t *word = &block[counter / FILTER_COUNTERS_PER_WORD];
+        uint64_t value = (*word >> shift) & FILTER_COUNTER_MAX;
+
+        if ((0 != value) && (FILTER_COUNTER_MAX != value)) {
+            *word -= UINT64_C(1) << shift;
+        }
+    }
+
+    return SCL_OK;
+}
+
+uint8_t membership_filter_may_include(const membership_filter_t * const __restrict__ filter, int32_t key) {
+    if (NULL == filter) {
+        return 1;
+    }
+
+    uint64_t hash = membership_filter_mix((uint64_t)(uint32_t)key);
+    const uint64_t *block = membership_filter_block(filter, hash);
+
+    for (int32_t probe = 0; probe < FILTER_HASH_PROBES; ++probe) {
+        uint32_t counter = (uint32_t)(hash >> (7 * probe)) & (FILTER_COUNTERS_PER_BLOCK - 1);
+        uint32_t shift = (counter % FILTER_COUNTERS_PER_WORD) * 4;
+
+        if (0 == ((block[counter / FILTER_COUNTERS_PER_WORD] >> shift) & FILTER_COUNTER_MAX)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+uint8_t membership_filter_lookup(membership_filter_t * const __restrict__ filter, int32_t key) {
+    if (NULL == filter) {
+        return 1;
+    }
+
+    ++(filter->stats.lookups);
+
+    if (0 == membership_filter_may_include(filter, key)) {
+        ++(filter->stats.negatives);
+        return 0;
+    }
+
+    ++(filter->stats.positives);
+
+    return 1;
+}
+
+void membership_filter_confirm(membership_filter_t * const __restrict__ filter, uint8_t found) {
+    if ((NULL != filter) && (0 == found)) {
+        ++(filter->stats.false_positives);
+    }
+}
+
+membership_filter_stats_t get_membership_filter_stats(const membership_filter_t * const __restrict__ filter) {
+    membership_filter_stats_t stats = { 0, 0, 0, 0 };
+
+    if (NULL != filter) {
+        stats = filter->stats;
+    }
+
+    return stats;
+}
+
+void reset_membership_filter_stats(membership_filter_t * const __restrict__ filter) {
+    if (NULL != filter) {
+        memset(&filter->stats, 0, sizeof(filter->stats));
+    }
+}
+
+double membership_filter_negative_rate(const membership_filter_t * const __restrict__ filter) {
+    if ((NULL == filter) || (0 == filter->stats.lookups)) {
+        return 0.0;
+    }
+
+    return (1.0 * filter->stats.negatives) / filter->stats.lookups;
+}
+
+double membership_filter_false_positive_rate(const membership_filter_t * const __restrict__ filter) {
+    if ((NULL == filter) || (0 == filter->stats.negatives + filter->stats.false_positives)) {
+        return 0.0;
+    }
+
+    return (1.0 * filter->stats.false_positives) / (filter->stats.negatives + filter->stats.false_positives);
+}
@@ -23,14 +23,22 @@
  */
 
 #include "./include/red_black_tree.h"
+#include "./include/int_writer.h"
+
+#define FINGER_MAX_CLIMB 8
 
 rbk_tree_t* create_rbk(void) {
     rbk_tree_t *new_tree = malloc(sizeof(*new_tree));
 
     if (NULL != new_tree) {
+        memset(&new_tree->memory, 0, sizeof(new_tree->memory));
+        scl_memory_alloc(&new_tree->memory, new_tree, sizeof(*new_tree));
+
         new_tree->nil = malloc(sizeof(*new_tree->nil));
 
         if (NULL != new_tree->nil) {
+            scl_memory_alloc(&new_tree->memory, new_tree->nil, sizeof(*new_tree->nil));
+
             new_tree->nil->data = INT32_MIN;
             new_tree->nil->color = BLACK;
             new_tree->nil->count = 1;
@@ -43,6 +51,9 @@ rbk_tree_t* create_rbk(void) {
 
         new_tree->root = new_tree->nil;
         new_tree->size = 0;
+        new_tree->filter = NULL;
+        new_tree->finger = new_tree->rightmost = new_tree->root;
+        new_tree->finger_mode = 0;
     } else {
         errno = ENOMEM;
         perror("Not enough memory for red-black allocation");
@@ -51,7 +62,7 @@ rbk_tree_t* create_rbk(void) {
     return new_tree;
 }
 
-static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tree, int32_t data) {
+static rbk_tree_node_t* create_rbk_node(rbk_tree_t * const __restrict__ tree, int32_t data) {
     if (NULL == tree) {
         errno = EINVAL;
         perror("Invalid red-black tree object");
@@ -62,6 +73,7 @@ static rbk_tree_node_t* create_rbk_node(const rbk_tree_t * const __restrict__ tr
     rbk_tree_node_t *new_node = malloc(sizeof(*new_node));
 
     if (NULL != new_node) {
+        scl_memory_alloc(&tree->memory, new_node, sizeof(*new_node));
         new_node->right = new_node->left = tree->nil;
         new_node->parent = tree->nil;
         new_node->count = 1;
@@ -240,42 +252,101 @@ static error_t rbk_insert_fix_node_up(rbk_tree_t * const __restrict__ tree, rbk_
     return SCL_OK;
 }
 
-error_t rbk_insert(rbk_tree_t * const __restrict__ tree, int32_t data) {
+static rbk_tree_node_t* rbk_finger_start(const rbk_tree_t * const __restrict__ tree, int32_t data) {
+    rbk_tree_node_t *iterator = tree->finger;
+
+    if (data > tree->rightmost->data) {
+        /* Appends become the right child of the largest node */
+        return tree->rightmost;
+    }
+
+    if ((tree->nil == iterator) || (data == iterator->data)) {
+        return (tree->nil != iterator) ? iterator : tree->root;
+    }
+
+    /*
+     * Climb from the last insertion point to the first ancestor whose subtree
+     * range holds data, so near-sorted keys only pay for the distance to the finger,
+     * keys far from the finger give up after a few levels and descend from the root.
+     */
+    for (uint32_t climb = 0; tree->root != iterator; ++climb) {
+        if (FINGER_MAX_CLIMB == climb) {
+            return tree->root;
+        }
+
+        rbk_tree_node_t *parent = iterator->parent;
+
+        if ((data > iterator->data) && (parent->left == iterator) && (parent->data >= data)) {
+            return (parent->data == data) ? parent : iterator;
+        }
+
+        if ((data < iterator->data) && (parent->right == iterator) && (parent->data <= data)) {
+            return (parent->data == data) ? parent : iterator;
+        }
+
+        iterator = parent;
+    }
+
+    return iterator;
+}
+
+error_t rbk_insert_finger_mode(rbk_tree_t * const __restrict__ tree, uint8_t enabled) {
     if (NULL == tree) {
         return SCL_NULL_RBK;
     }
 
+    tree->finger_mode = (0 != enabled);
+    tree->finger = tree->rightmost = tree->nil;
+
+    return SCL_OK;
+}
+
+static rbk_tree_node_t* rbk_insert_position(rbk_tree_t * const __restrict__ tree, int32_t data, rbk_tree_node_t ** const parent_node) {
     rbk_tree_node_t *iterator = tree->root;
-    rbk_tree_node_t *parent_iterator = tree->nil;
+
+    *parent_node = tree->nil;
+
+    if ((0 != tree->finger_mode) && (tree->nil != tree->root)) {
+        if (tree->nil == tree->rightmost) {
+            tree->rightmost = tree->root;
+
+            while (tree->nil != tree->rightmost->right) {
+                tree->rightmost = tree->rightmost->right;
+            }
+        }
+
+        iterator = rbk_finger_start(tree, data);
+    }
 
     while (tree->nil != iterator) {
-        parent_iterator = iterator;
+        *parent_node = iterator;
 
         if (iterator->data > data) {
             iterator = iterator->left;
         } else if (iterator->data < data) {
             iterator = iterator->right;
         } else {
-            ++(iterator->count);
-            return SCL_OK;
+            return iterator;
         }
     }
 
-    rbk_tree_node_t *new_node = create_rbk_node(tree, data);
+    return tree->nil;
+}
 
-    if (tree->nil == new_node) {
-        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+static error_t rbk_link_node(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const parent_node, rbk_tree_node_t * const new_node) {
+    if (NULL != tree->filter) {
+        membership_filter_insert(tree->filter, new_node->data);
     }
     
     error_t err = SCL_OK;
 
-    if (tree->nil != parent_iterator) {
-        new_node->parent = parent_iterator;
+    if (tree->nil != parent_node) {
+        new_node->parent = parent_node;
 
-        if (parent_iterator->data > new_node->data) {
-            parent_iterator->left = new_node;
+        if (parent_node->data > new_node->data) {
+            parent_node->left = new_node;
         } else {
-            parent_iterator->right = new_node;
+            parent_node->right = new_node;
         }
 
         err = rbk_insert_fix_node_up(tree, new_node);
@@ -286,9 +357,44 @@ error_t rbk_insert(rbk_tree_t * const __restrict__ tree, int32_t data) {
 
     ++(tree->size);
 
+    if (0 != tree->finger_mode) {
+        tree->finger = new_node;
+
+        if ((tree->nil == tree->rightmost) || (new_node->data > tree->rightmost->data)) {
+            tree->rightmost = new_node;
+        }
+    }
+
     return err;
 }
 
+error_t rbk_insert(rbk_tree_t * const __restrict__ tree, int32_t data) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    rbk_tree_node_t *parent_iterator = tree->nil;
+    rbk_tree_node_t *iterator = rbk_insert_position(tree, data, &parent_iterator);
+
+    if (tree->nil != iterator) {
+        ++(iterator->count);
+
+        if (0 != tree->finger_mode) {
+            tree->finger = iterator;
+        }
+
+        return SCL_OK;
+    }
+
+    rbk_tree_node_t *new_node = create_rbk_node(tree, data);
+
+    if (tree->nil == new_node) {
+        return SCL_NOT_ENOUGHT_MEM_FOR_NODE;
+    }
+
+    return rbk_link_node(tree, parent_iterator, new_node);
+}
+
 static rbk_tree_node_t* rbk_find_node(const rbk_tree_t * const __restrict__ tree, int32_t data) {
     if ((NULL == tree) || (tree->nil == tree->root)) {
         return tree->nil;
@@ -399,14 +505,179 @@ size_t get_rbk_size(const rbk_tree_t * const __restrict__ tree) {
     return tree->size;
 }
 
+error_t rbk_memory_stats(const rbk_tree_t * const __restrict__ tree, set_memory_stats_t * const stats) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    *stats = tree->memory;
+    stats->keys = tree->size;
+
+    /* The header and the nil sentinel, every other allocation is a node holding a key */
+    stats->overhead_bytes = sizeof(*tree) + sizeof(*tree->nil);
+
+    return SCL_OK;
+}
+
 uint8_t rbk_includes(const rbk_tree_t * const __restrict__ tree, int32_t data) {
     if (NULL == tree) {
         return 0;
     }
 
+    if (NULL != tree->filter) {
+        if (0 == membership_filter_lookup(tree->filter, data)) {
+            return 0;
+        }
+
+        uint8_t found = (tree->nil != rbk_find_node(tree, data));
+
+        membership_filter_confirm(tree->filter, found);
+
+        return found;
+    }
+
     return (tree->nil != rbk_find_node(tree, data));
 }
 
+static rbk_tree_node_t* rbk_lower_bound_from(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t *finger, int32_t data) {
+    rbk_tree_node_t *candidate = tree->nil;
+
+    if (tree->nil == finger) {
+        finger = tree->root;
+    } else {
+        /*
+         * Climb until the subtree of the finger is bounded above by a key not less
+         * than data, the bounding ancestor is the answer unless a smaller key of
+         * the subtree also qualifies, so the descent starts with it as a candidate.
+         */
+        while (tree->root != finger) {
+            rbk_tree_node_t *parent = finger->parent;
+
+            if ((parent->left == finger) && (parent->data >= data)) {
+                candidate = parent;
+                break;
+            }
+
+            finger = parent;
+        }
+    }
+
+    while (tree->nil != finger) {
+        if (finger->data >= data) {
+            candidate = finger;
+            finger = finger->left;
+        } else {
+            finger = finger->right;
+        }
+    }
+
+    return candidate;
+}
+
+/*
+ * The finger is the lower bound of finger_data, so no key lies in [finger_data, finger),
+ * keys smaller than finger_data (out of order batches) restart from the root.
+ */
+static rbk_tree_node_t* rbk_next_lower_bound(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const finger, int32_t finger_data, int32_t data) {
+    if ((tree->nil == finger) || (data < finger_data)) {
+        return rbk_lower_bound_from(tree, tree->nil, data);
+    }
+
+    if (finger->data >= data) {
+        return finger;
+    }
+
+    return rbk_lower_bound_from(tree, finger, data);
+}
+
+size_t rbk_lower_bound_batch(const rbk_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, int32_t * const bounds) {
+    if ((NULL == tree) || (NULL == keys) || (NULL == bounds)) {
+        return 0;
+    }
+
+    rbk_tree_node_t *finger = tree->nil;
+    int32_t finger_data = 0;
+    size_t bounded_keys = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        finger = rbk_next_lower_bound(tree, finger, finger_data, keys[iter]);
+        finger_data = keys[iter];
+
+        if (tree->nil != finger) {
+            bounds[iter] = finger->data;
+            ++bounded_keys;
+        } else {
+            /* No key is greater or equal, the bound is past the largest key */
+            bounds[iter] = INT32_MAX;
+        }
+    }
+
+    return bounded_keys;
+}
+
+size_t rbk_includes_sorted_batch(const rbk_tree_t * const __restrict__ tree, const int32_t * const keys, size_t length, uint8_t * const found) {
+    if ((NULL == tree) || (NULL == keys) || (NULL == found)) {
+        return 0;
+    }
+
+    rbk_tree_node_t *finger = tree->nil;
+    int32_t finger_data = 0;
+    size_t found_keys = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        found[iter] = 0;
+
+        /* Keys ruled out by the filter leave the finger where it is */
+        if (0 == membership_filter_lookup(tree->filter, keys[iter])) {
+            continue;
+        }
+
+        finger = rbk_next_lower_bound(tree, finger, finger_data, keys[iter]);
+        finger_data = keys[iter];
+        found[iter] = (tree->nil != finger) && (finger->data == keys[iter]);
+        found_keys += found[iter];
+
+        membership_filter_confirm(tree->filter, found[iter]);
+    }
+
+    return found_keys;
+}
+
+static void rbk_attach_filter_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, membership_filter_t * const __restrict__ filter) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    membership_filter_insert(filter, root->data);
+
+    rbk_attach_filter_helper(tree, root->left, filter);
+    rbk_attach_filter_helper(tree, root->right, filter);
+}
+
+error_t rbk_attach_filter(rbk_tree_t * const __restrict__ tree, membership_filter_t * const filter) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    tree->filter = filter;
+
+    if (NULL != filter) {
+        error_t err = membership_filter_clear(filter);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        rbk_attach_filter_helper(tree, tree->root, filter);
+    }
+
+    return SCL_OK;
+}
+
 static rbk_tree_node_t* rbk_max_node(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * __restrict__ root) {
     if (tree->nil != root) {
         while (tree->nil != root->right) {
@@ -471,6 +742,7 @@ static error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree, rbk_
                 brother_node->color = RED;
 
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (BLACK == brother_node->right->color) {
                     brother_node->left->color = BLACK;
@@ -504,6 +776,7 @@ static error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree, rbk_
                 brother_node->color = RED;
 
                 fix_node = parent_fix_node;
+                parent_fix_node = fix_node->parent;
             } else {
                 if (BLACK == brother_node->left->color) {
                     brother_node->right->color = BLACK;
@@ -529,19 +802,14 @@ static error_t rbk_delete_fix_node_up(rbk_tree_t * const __restrict__ tree, rbk_
     return SCL_OK;
 }
 
-error_t rbk_delete(rbk_tree_t * const __restrict__ tree, int32_t data) {
-    if (NULL == tree) {
-        return SCL_NULL_RBK;
-    }
-
-    if (tree->nil == tree->root) {
-        return SCL_DELETE_FROM_EMPTY_OBJECT;
+static error_t rbk_unlink_node(rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const delete_node) {
+    /* Nodes keep their identity when deleting, only a removed finger has to be forgotten */
+    if (tree->finger == delete_node) {
+        tree->finger = tree->nil;
     }
 
-    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
-
-    if (tree->nil == delete_node) {
-        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    if (tree->rightmost == delete_node) {
+        tree->rightmost = tree->nil;
     }
 
     if ((tree->nil != delete_node->left) && (tree->nil != delete_node->right)) {
@@ -616,12 +884,10 @@ error_t rbk_delete(rbk_tree_t * const __restrict__ tree, int32_t data) {
 
     rbk_tree_node_t *parent_delete_node = delete_node->parent;
 
-    if (tree->nil != delete_node) {
-        free(delete_node);
+    if (NULL != tree->filter) {
+        membership_filter_delete(tree->filter, delete_node->data);
     }
 
-    delete_node = tree->nil;
-
     --(tree->size);
 
     if ((0 != need_fixing_tree) && (tree->nil != parent_delete_node)) {
@@ -631,20 +897,120 @@ error_t rbk_delete(rbk_tree_t * const __restrict__ tree, int32_t data) {
     return SCL_OK;
 }
 
+error_t rbk_delete(rbk_tree_t * const __restrict__ tree, int32_t data) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    rbk_tree_node_t *delete_node = rbk_find_node(tree, data);
+
+    if (tree->nil == delete_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    error_t err = rbk_unlink_node(tree, delete_node);
+
+    if (SCL_CANNOT_SWAP_DATA != err) {
+        scl_memory_free(&tree->memory, delete_node, sizeof(*delete_node));
+        free(delete_node);
+    }
+
+    return err;
+}
+
+static uint8_t rbk_fits_in_place(const rbk_tree_t * const __restrict__ tree, rbk_tree_node_t * const __restrict__ node, int32_t data) {
+    const rbk_tree_node_t *iterator = node;
+
+    if (data < node->data) {
+        if (tree->nil != node->left) {
+            return (rbk_max_node(tree, node->left)->data < data);
+        }
+
+        while ((tree->nil != iterator->parent) && (iterator->parent->left == iterator)) {
+            iterator = iterator->parent;
+        }
+
+        return ((tree->nil == iterator->parent) || (iterator->parent->data < data));
+    }
+
+    if (data > node->data) {
+        if (tree->nil != node->right) {
+            return (rbk_min_node(tree, node->right)->data > data);
+        }
+
+        while ((tree->nil != iterator->parent) && (iterator->parent->right == iterator)) {
+            iterator = iterator->parent;
+        }
+
+        return ((tree->nil == iterator->parent) || (iterator->parent->data > data));
+    }
+
+    return 1;
+}
+
 error_t rbk_modify_data(rbk_tree_t * const __restrict__ tree, int32_t old_data, int32_t new_data) {
     if (NULL == tree) {
         return SCL_NULL_RBK;
     }
 
-    error_t err = rbk_delete(tree, old_data);
+    if (tree->nil == tree->root) {
+        return SCL_DELETE_FROM_EMPTY_OBJECT;
+    }
+
+    rbk_tree_node_t *modify_node = rbk_find_node(tree, old_data);
+
+    if (tree->nil == modify_node) {
+        return SCL_DATA_NOT_FOUND_FOR_DELETE;
+    }
+
+    /* The new key keeps the in-order position of the old one, so no node has to move */
+    if (0 != rbk_fits_in_place(tree, modify_node, new_data)) {
+        if ((NULL != tree->filter) && (old_data != new_data)) {
+            membership_filter_delete(tree->filter, old_data);
+            membership_filter_insert(tree->filter, new_data);
+        }
+
+        modify_node->data = new_data;
+        modify_node->count = 1;
+
+        return SCL_OK;
+    }
+
+    error_t err = rbk_unlink_node(tree, modify_node);
 
     if (SCL_OK != err) {
+        /* Like a delete, the node is already unlinked unless it could not be swapped */
+        if (SCL_CANNOT_SWAP_DATA != err) {
+            scl_memory_free(&tree->memory, modify_node, sizeof(*modify_node));
+            free(modify_node);
+        }
+
         return err;
     }
 
-    err = rbk_insert(tree, new_data);
+    rbk_tree_node_t *parent_node = tree->nil;
+    rbk_tree_node_t *existing_node = rbk_insert_position(tree, new_data, &parent_node);
 
-    return err;
+    if (tree->nil != existing_node) {
+        ++(existing_node->count);
+        scl_memory_free(&tree->memory, modify_node, sizeof(*modify_node));
+        free(modify_node);
+
+        return SCL_OK;
+    }
+
+    /* Reuse the unlinked node instead of freeing it and allocating a new one */
+    modify_node->right = modify_node->left = tree->nil;
+    modify_node->parent = tree->nil;
+    modify_node->count = 1;
+    modify_node->color = RED;
+    modify_node->data = new_data;
+
+    return rbk_link_node(tree, parent_node, modify_node);
 }
 
 error_t rbk_delete_max(rbk_tree_t * const __restrict__ tree) {
@@ -679,14 +1045,14 @@ error_t rbk_delete_min(rbk_tree_t * const __restrict__ tree) {
     return err;
 }
 
-static void rbk_traverse_inorder_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, FILE *fout) {
+static void rbk_traverse_inorder_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, int_writer_t * const __restrict__ writer) {
     if (tree->nil == root) {
         return;
     }
 
-    rbk_traverse_inorder_helper(tree, root->left, fout);
-    fprintf(fout, "%d ", root->data);
-    rbk_traverse_inorder_helper(tree, root->right, fout);
+    rbk_traverse_inorder_helper(tree, root->left, writer);
+    int_writer_put_int(writer, root->data);
+    rbk_traverse_inorder_helper(tree, root->right, writer);
 }
 
 error_t rbk_traverse_inorder(const rbk_tree_t * const __restrict__ tree, FILE *fout) {
@@ -698,9 +1064,147 @@ error_t rbk_traverse_inorder(const rbk_tree_t * const __restrict__ tree, FILE *f
         fprintf(fout, "(Null)\n");
     }
     else {
-        rbk_traverse_inorder_helper(tree, tree->root, fout);
-        fprintf(fout, "\n");
+        int_writer_t *writer = create_int_writer_stream(fout, INT_WRITER_BUFFER_SIZE);
+
+        if (NULL == writer) {
+            return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        rbk_traverse_inorder_helper(tree, tree->root, writer);
+        int_writer_put_bytes(writer, "\n", 1);
+
+        return free_int_writer(writer);
     }
 
     return SCL_OK;
 }
+
+static void rbk_traverse_visit_helper(const rbk_tree_t * const __restrict__ tree, const rbk_tree_node_t * const __restrict__ root, set_visit_func visit, void *context) {
+    if (tree->nil == root) {
+        return;
+    }
+
+    rbk_traverse_visit_helper(tree, root->left, visit, context);
+    visit(root->data, context);
+    rbk_traverse_visit_helper(tree, root->right, visit, context);
+}
+
+error_t rbk_traverse_visit(const rbk_tree_t * const __restrict__ tree, set_visit_func visit, void *context) {
+    if (NULL == tree) {
+        return SCL_NULL_RBK;
+    }
+
+    if (NULL == visit) {
+        return SCL_INVALID_INPUT;
+    }
+
+    rbk_traverse_visit_helper(tree, tree->root, visit, context);
+
+    return SCL_OK;
+}
+
+static void* rbk_set_create(size_t capacity_hint, hash_func hash) {
+    return create_rbk();
+}
+
+static error_t rbk_set_free(void * const set) {
+    return free_rbk(set);
+}
+
+static error_t rbk_set_insert(void * const set, int32_t key) {
+    return rbk_insert(set, key);
+}
+
+static error_t rbk_set_delete(void * const set, int32_t key) {
+    return rbk_delete(set, key);
+}
+
+static error_t rbk_set_modify(void * const set, int32_t old_key, int32_t new_key) {
+    return rbk_modify_data(set, old_key, new_key);
+}
+
+static uint8_t rbk_set_includes(const void * const set, int32_t key) {
+    return rbk_includes(set, key);
+}
+
+/* The tree returns the data of its nil node on an empty tree, the set interface wants the sentinels */
+static int32_t rbk_set_min(const void * const set) {
+    return (0 != is_rbk_empty(set)) ? INT32_MAX : rbk_min_data(set);
+}
+
+static int32_t rbk_set_max(const void * const set) {
+    return (0 != is_rbk_empty(set)) ? INT32_MIN : rbk_max_data(set);
+}
+
+static error_t rbk_set_delete_min(void * const set) {
+    return rbk_delete_min(set);
+}
+
+static error_t rbk_set_delete_max(void * const set) {
+    return rbk_delete_max(set);
+}
+
+static error_t rbk_set_traverse(const void * const set, FILE *fout) {
+    return rbk_traverse_inorder(set, fout);
+}
+
+static error_t rbk_set_visit(const void * const set, set_visit_func visit, void *context) {
+    return rbk_traverse_visit(set, visit, context);
+}
+
+static size_t rbk_set_size(const void * const set) {
+    return get_rbk_size(set);
+}
+
+static error_t rbk_set_memory_stats(const void * const set, set_memory_stats_t * const stats) {
+    return rbk_memory_stats(set, stats);
+}
+
+static size_t rbk_set_insert_batch(void * const set, const int32_t * const keys, size_t length) {
+    rbk_tree_t * const tree = set;
+    size_t inserted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        inserted += (SCL_OK == rbk_insert(tree, keys[iter]));
+    }
+
+    return inserted;
+}
+
+static size_t rbk_set_delete_batch(void * const set, const int32_t * const keys, size_t length) {
+    rbk_tree_t * const tree = set;
+    size_t deleted = 0;
+
+    for (size_t iter = 0; iter < length; ++iter) {
+        deleted += (SCL_OK == rbk_delete(tree, keys[iter]));
+    }
+
+    return deleted;
+}
+
+static size_t rbk_set_includes_batch(const void * const set, const int32_t * const keys, size_t length, uint8_t * const found) {
+    /* Sorted runs reuse the finger, out of order keys fall back to a search from the root */
+    return rbk_includes_sorted_batch(set, keys, length, found);
+}
+
+const set_ops_t rbk_set_ops = {
+    .name = "rbk",
+    .create = rbk_set_create,
+    .free = rbk_set_free,
+    .insert = rbk_set_insert,
+    .delete = rbk_set_delete,
+    .modify = rbk_set_modify,
+    .includes = rbk_set_includes,
+    .min = rbk_set_min,
+    .max = rbk_set_max,
+    .delete_min = rbk_set_delete_min,
+    .delete_max = rbk_set_delete_max,
+    .traverse = rbk_set_traverse,
+    .visit = rbk_set_visit,
+    .size = rbk_set_size,
+    .insert_batch = rbk_set_insert_batch,
+    .delete_batch = rbk_set_delete_batch,
+    .includes_batch = rbk_set_includes_batch,
+    .ordered = 1,
+    .memory_stats = rbk_set_memory_stats,
+};
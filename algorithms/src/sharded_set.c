@@ -0,0 +1,753 @@
+/**
+ * @file sharded_set.c
+ * @author Mihai Negru (determinant289@gmail.com)
+ * @version 1.0.0
+ * @date 2022-12-18
+ * 
+ * @copyright Copyright (C) 2022-2023 Mihai Negru <determinant289@gmail.com>
+ * This file is part of data-structures-comparison.
+ * 
+ * data-structures-comparison is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * data-structures-comparison is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with data-structures-comparison.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+#include "./include/sharded_set.h"
+#include "./include/avl_tree.h"
+#include "./include/red_black_tree.h"
+#include "./include/hash_table_linked.h"
+#include "./include/int_writer.h"
+
+/**
+ * @brief Keys of one shard gathered by the merged traversal,
+ * the keys of an unordered engine are sorted before merging
+ * 
+ */
+typedef struct sharded_set_run_s {
+    int32_t *keys;                                              /* Keys visited in the shard */
+    size_t length;                                              /* Number of visited keys */
+    size_t capacity;                                            /* Number of keys that fit in the array */
+    size_t next;                                                /* Next key to merge */
+    uint8_t failed;                                             /* Set when the array could not grow */
+} sharded_set_run_t;
+
+static sharded_set_t* create_sharded_set_helper(const set_ops_t * const ops, size_t shard_count, size_t capacity_hint, hash_func hash) {
+    if ((NULL == ops) || (0 == shard_count)) {
+        errno = EINVAL;
+        perror("Invalid sharded set parameters");
+
+        return NULL;
+    }
+
+    sharded_set_t *new_set = malloc(sizeof(*new_set));
+
+    if (NULL == new_set) {
+        errno = ENOMEM;
+        perror("Not enough memory for sharded set allocation");
+
+        return NULL;
+    }
+
+    new_set->shards = aligned_alloc(SHARDED_SET_CACHE_LINE, sizeof(*new_set->shards) * shard_count);
+
+    if (NULL == new_set->shards) {
+        free(new_set);
+
+        errno = ENOMEM;
+        perror("Not enough memory for sharded set shards allocation");
+
+        return NULL;
+    }
+
+    memset(&new_set->memory, 0, sizeof(new_set->memory));
+    scl_memory_alloc(&new_set->memory, new_set, sizeof(*new_set));
+    scl_memory_alloc(&new_set->memory, new_set->shards, sizeof(*new_set->shards) * shard_count);
+
+    new_set->ops = ops;
+    new_set->shard_count = shard_count;
+    new_set->partition = SHARDED_HASH_PARTITION;
+    new_set->range_min = INT32_MIN;
+    new_set->range_width = 1;
+
+    for (size_t iter = 0; iter < shard_count; ++iter) {
+        new_set->shards[iter].set = ops->create(capacity_hint / shard_count + 1, hash);
+
+        if ((NULL == new_set->shards[iter].set) || (0 != pthread_mutex_init(&new_set->shards[iter].lock, NULL))) {
+            if (NULL != new_set->shards[iter].set) {
+                ops->free(new_set->shards[iter].set);
+            }
+
+            new_set->shard_count = iter;
+            free_sharded_set(new_set);
+
+            errno = ENOMEM;
+            perror("Not enough memory for sharded set shard allocation");
+
+            return NULL;
+        }
+    }
+
+    return new_set;
+}
+
+sharded_set_t* create_sharded_set(const set_ops_t * const ops, size_t shard_count, size_t capacity_hint, hash_func hash) {
+    return create_sharded_set_helper(ops, shard_count, capacity_hint, hash);
+}
+
+sharded_set_t* create_sharded_set_range(const set_ops_t * const ops, size_t shard_count, size_t capacity_hint, hash_func hash, int32_t range_min, int32_t range_max) {
+    if (range_min > range_max) {
+        errno = EINVAL;
+        perror("Invalid sharded set key range");
+
+        return NULL;
+    }
+
+    sharded_set_t *new_set = create_sharded_set_helper(ops, shard_count, capacity_hint, hash);
+
+    if (NULL != new_set) {
+        uint64_t range_keys = (uint64_t)((int64_t)range_max - range_min) + 1;
+
+        new_set->partition = SHARDED_RANGE_PARTITION;
+        new_set->range_min = range_min;
+        new_set->range_width = (range_keys + shard_count - 1) / shard_count;
+    }
+
+    return new_set;
+}
+
+error_t free_sharded_set(sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    if (NULL != set->shards) {
+        for (size_t iter = 0; iter < set->shard_count; ++iter) {
+            set->ops->free(set->shards[iter].set);
+            pthread_mutex_destroy(&set->shards[iter].lock);
+        }
+
+        free(set->shards);
+        set->shards = NULL;
+    }
+
+    free(set);
+
+    return SCL_OK;
+}
+
+size_t sharded_set_shard_index(const sharded_set_t * const __restrict__ set, int32_t key) {
+    if (NULL == set) {
+        return SIZE_MAX;
+    }
+
+    if (SHARDED_RANGE_PARTITION == set->partition) {
+        if (key <= set->range_min) {
+            return 0;
+        }
+
+        uint64_t shard_index = (uint64_t)((int64_t)key - set->range_min) / set->range_width;
+
+        return (shard_index < set->shard_count) ? (size_t)shard_index : (set->shard_count - 1);
+    }
+
+    /* Fibonacci hashing, unrelated to the hash used inside the shards so their buckets stay evenly used */
+    uint64_t hash = ((uint64_t)(uint32_t)key * UINT64_C(0x9e3779b97f4a7c15)) >> 32;
+
+    return (size_t)((hash * set->shard_count) >> 32);
+}
+
+static void sharded_set_lock_all(const sharded_set_t * const __restrict__ set) {
+    /* Always in increasing shard order, so two threads locking many shards cannot deadlock */
+    for (size_t iter = 0; iter < set->shard_count; ++iter) {
+        pthread_mutex_lock(&set->shards[iter].lock);
+    }
+}
+
+static void sharded_set_unlock_all(const sharded_set_t * const __restrict__ set) {
+    for (size_t iter = set->shard_count; iter > 0; --iter) {
+        pthread_mutex_unlock(&set->shards[iter - 1].lock);
+    }
+}
+
+error_t sharded_set_insert(sharded_set_t * const __restrict__ set, int32_t key) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    sharded_set_shard_t *shard = &set->shards[sharded_set_shard_index(set, key)];
+
+    pthread_mutex_lock(&shard->lock);
+    error_t err = set->ops->insert(shard->set, key);
+    pthread_mutex_unlock(&shard->lock);
+
+    return err;
+}
+
+error_t sharded_set_delete(sharded_set_t * const __restrict__ set, int32_t key) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    sharded_set_shard_t *shard = &set->shards[sharded_set_shard_index(set, key)];
+
+    pthread_mutex_lock(&shard->lock);
+    error_t err = set->ops->delete(shard->set, key);
+    pthread_mutex_unlock(&shard->lock);
+
+    return err;
+}
+
+error_t sharded_set_modify(sharded_set_t * const __restrict__ set, int32_t old_key, int32_t new_key) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    size_t old_index = sharded_set_shard_index(set, old_key);
+    size_t new_index = sharded_set_shard_index(set, new_key);
+
+    error_t err = SCL_OK;
+
+    if (old_index == new_index) {
+        pthread_mutex_lock(&set->shards[old_index].lock);
+        err = set->ops->modify(set->shards[old_index].set, old_key, new_key);
+        pthread_mutex_unlock(&set->shards[old_index].lock);
+
+        return err;
+    }
+
+    /* Both shards are held, so no thread sees the key missing from both of them */
+    size_t first_index = (old_index < new_index) ? old_index : new_index;
+    size_t second_index = (old_index < new_index) ? new_index : old_index;
+
+    pthread_mutex_lock(&set->shards[first_index].lock);
+    pthread_mutex_lock(&set->shards[second_index].lock);
+
+    err = set->ops->delete(set->shards[old_index].set, old_key);
+
+    if (SCL_OK == err) {
+        err = set->ops->insert(set->shards[new_index].set, new_key);
+    }
+
+    pthread_mutex_unlock(&set->shards[second_index].lock);
+    pthread_mutex_unlock(&set->shards[first_index].lock);
+
+    return err;
+}
+
+uint8_t sharded_set_includes(const sharded_set_t * const __restrict__ set, int32_t key) {
+    if (NULL == set) {
+        return 0;
+    }
+
+    sharded_set_shard_t *shard = &set->shards[sharded_set_shard_index(set, key)];
+
+    pthread_mutex_lock(&shard->lock);
+    uint8_t found = set->ops->includes(shard->set, key);
+    pthread_mutex_unlock(&shard->lock);
+
+    return found;
+}
+
+uint8_t is_sharded_set_empty(const sharded_set_t * const __restrict__ set) {
+    size_t size = get_sharded_set_size(set);
+
+    return (0 == size) || (SIZE_MAX == size);
+}
+
+size_t get_sharded_set_size(const sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return SIZE_MAX;
+    }
+
+    size_t size = 0;
+
+    for (size_t iter = 0; iter < set->shard_count; ++iter) {
+        pthread_mutex_lock(&set->shards[iter].lock);
+        size += set->ops->size(set->shards[iter].set);
+        pthread_mutex_unlock(&set->shards[iter].lock);
+    }
+
+    return size;
+}
+
+/* The sharded set itself plus every shard, the peak is the sum of the shard peaks, an upper bound */
+error_t sharded_set_memory_stats(const sharded_set_t * const __restrict__ set, set_memory_stats_t * const stats) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    if (NULL == stats) {
+        return SCL_INVALID_INPUT;
+    }
+
+    if (NULL == set->ops->memory_stats) {
+        return SCL_UNDEFINED_DATA;
+    }
+
+    *stats = set->memory;
+    stats->overhead_bytes = set->memory.live_bytes;
+
+    for (size_t iter = 0; iter < set->shard_count; ++iter) {
+        set_memory_stats_t shard_stats;
+
+        pthread_mutex_lock(&set->shards[iter].lock);
+        error_t err = set->ops->memory_stats(set->shards[iter].set, &shard_stats);
+        pthread_mutex_unlock(&set->shards[iter].lock);
+
+        if (SCL_OK != err) {
+            return err;
+        }
+
+        scl_memory_merge(stats, &shard_stats);
+    }
+
+    return SCL_OK;
+}
+
+/* Shard holding the largest (max_shard != 0) or the smallest key, the caller holds every lock */
+static size_t sharded_set_extreme_shard(const sharded_set_t * const __restrict__ set, uint8_t max_shard) {
+    size_t extreme_index = set->shard_count;
+    int32_t extreme_key = 0;
+
+    for (size_t iter = 0; iter < set->shard_count; ++iter) {
+        size_t shard_index = ((0 != max_shard) && (SHARDED_RANGE_PARTITION == set->partition)) ? (set->shard_count - iter - 1) : iter;
+        void *shard_set = set->shards[shard_index].set;
+
+        if (0 == set->ops->size(shard_set)) {
+            continue;
+        }
+
+        int32_t key = (0 != max_shard) ? set->ops->max(shard_set) : set->ops->min(shard_set);
+
+        if ((set->shard_count == extreme_index) || ((0 != max_shard) ? (key > extreme_key) : (key < extreme_key))) {
+            extreme_index = shard_index;
+            extreme_key = key;
+        }
+
+        /* The first non empty slice from the matching end already holds the answer */
+        if (SHARDED_RANGE_PARTITION == set->partition) {
+            break;
+        }
+    }
+
+    return extreme_index;
+}
+
+int32_t sharded_set_get_max(const sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return INT32_MIN;
+    }
+
+    sharded_set_lock_all(set);
+
+    size_t shard_index = sharded_set_extreme_shard(set, 1);
+    int32_t max_key = (set->shard_count != shard_index) ? set->ops->max(set->shards[shard_index].set) : INT32_MIN;
+
+    sharded_set_unlock_all(set);
+
+    return max_key;
+}
+
+int32_t sharded_set_get_min(const sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return INT32_MAX;
+    }
+
+    sharded_set_lock_all(set);
+
+    size_t shard_index = sharded_set_extreme_shard(set, 0);
+    int32_t min_key = (set->shard_count != shard_index) ? set->ops->min(set->shards[shard_index].set) : INT32_MAX;
+
+    sharded_set_unlock_all(set);
+
+    return min_key;
+}
+
+error_t sharded_set_delete_max(sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    sharded_set_lock_all(set);
+
+    size_t shard_index = sharded_set_extreme_shard(set, 1);
+    error_t err = (set->shard_count != shard_index) ? set->ops->delete_max(set->shards[shard_index].set) : SCL_DELETE_FROM_EMPTY_OBJECT;
+
+    sharded_set_unlock_all(set);
+
+    return err;
+}
+
+error_t sharded_set_delete_min(sharded_set_t * const __restrict__ set) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    sharded_set_lock_all(set);
+
+    size_t shard_index = sharded_set_extreme_shard(set, 0);
+    error_t err = (set->shard_count != shard_index) ? set->ops->delete_min(set->shards[shard_index].set) : SCL_DELETE_FROM_EMPTY_OBJECT;
+
+    sharded_set_unlock_all(set);
+
+    return err;
+}
+
+static void sharded_set_run_push(int32_t key, void *context) {
+    sharded_set_run_t * const run = context;
+
+    if (run->length == run->capacity) {
+        size_t new_capacity = (0 == run->capacity) ? 64 : (run->capacity << 1);
+        int32_t *new_keys = realloc(run->keys, sizeof(*new_keys) * new_capacity);
+
+        if (NULL == new_keys) {
+            run->failed = 1;
+            return;
+        }
+
+        run->keys = new_keys;
+        run->capacity = new_capacity;
+    }
+
+    run->keys[run->length++] = key;
+}
+
+static int sharded_set_compare_keys(const void *left, const void *right) {
+    int32_t left_key = *(const int32_t *)left;
+    int32_t right_key = *(const int32_t *)right;
+
+    return (left_key > right_key) - (left_key < right_key);
+}
+
+static void sharded_set_heap_sift_down(const sharded_set_run_t * const runs, size_t * const heap, size_t heap_size, size_t index) {
+    for (;;) {
+        size_t smallest = index;
+        size_t left = (index << 1) + 1;
+        size_t right = left + 1;
+
+        if ((left < heap_size) && (runs[heap[left]].keys[runs[heap[left]].next] < runs[heap[smallest]].keys[runs[heap[smallest]].next])) {
+            smallest = left;
+        }
+
+        if ((right < heap_size) && (runs[heap[right]].keys[runs[heap[right]].next] < runs[heap[smallest]].keys[runs[heap[smallest]].next])) {
+            smallest = right;
+        }
+
+        if (smallest == index) {
+            return;
+        }
+
+        size_t temp = heap[index];
+        heap[index] = heap[smallest];
+        heap[smallest] = temp;
+
+        index = smallest;
+    }
+}
+
+/* Gathers every shard as a sorted run and merges the runs with a min heap of the run heads */
+static error_t sharded_set_merge_visit(const sharded_set_t * const __restrict__ set, set_visit_func visit, void *context) {
+    sharded_set_run_t *runs = calloc(set->shard_count, sizeof(*runs));
+    size_t *heap = malloc(sizeof(*heap) * set->shard_count);
+
+    error_t err = SCL_OK;
+
+    if ((NULL == runs) || (NULL == heap)) {
+        errno = ENOMEM;
+        perror("Not enough memory for sharded set traversal");
+
+        err = SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    size_t heap_size = 0;
+
+    for (size_t iter = 0; (SCL_OK == err) && (iter < set->shard_count); ++iter) {
+        err = set->ops->visit(set->shards[iter].set, sharded_set_run_push, &runs[iter]);
+
+        if ((SCL_OK == err) && (0 != runs[iter].failed)) {
+            errno = ENOMEM;
+            perror("Not enough memory for sharded set traversal");
+
+            err = SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+        }
+
+        if ((SCL_OK == err) && (0 == set->ops->ordered) && (0 != runs[iter].length)) {
+            qsort(runs[iter].keys, runs[iter].length, sizeof(*runs[iter].keys), sharded_set_compare_keys);
+        }
+
+        if ((SCL_OK == err) && (0 != runs[iter].length)) {
+            heap[heap_size++] = iter;
+        }
+    }
+
+    if (SCL_OK == err) {
+        for (size_t iter = heap_size / 2; iter > 0; --iter) {
+            sharded_set_heap_sift_down(runs, heap, heap_size, iter - 1);
+        }
+
+        while (0 != heap_size) {
+            sharded_set_run_t *run = &runs[heap[0]];
+
+            visit(run->keys[run->next++], context);
+
+            if (run->next == run->length) {
+                heap[0] = heap[--heap_size];
+            }
+
+            sharded_set_heap_sift_down(runs, heap, heap_size, 0);
+        }
+    }
+
+    if (NULL != runs) {
+        for (size_t iter = 0; iter < set->shard_count; ++iter) {
+            free(runs[iter].keys);
+        }
+    }
+
+    free(runs);
+    free(heap);
+
+    return err;
+}
+
+/* Visits the keys in increasing order, the caller holds the locks of all shards */
+static error_t sharded_set_visit_locked(const sharded_set_t * const __restrict__ set, set_visit_func visit, void *context) {
+    error_t err = SCL_OK;
+
+    if ((SHARDED_RANGE_PARTITION == set->partition) && (0 != set->ops->ordered)) {
+        /* Ordered slices of the key space, the shards are simply visited one after another */
+        for (size_t iter = 0; (SCL_OK == err) && (iter < set->shard_count); ++iter) {
+            err = set->ops->visit(set->shards[iter].set, visit, context);
+        }
+    } else {
+        err = sharded_set_merge_visit(set, visit, context);
+    }
+
+    return err;
+}
+
+error_t sharded_set_traverse_visit(const sharded_set_t * const __restrict__ set, set_visit_func visit, void *context) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    if (NULL == visit) {
+        return SCL_INVALID_INPUT;
+    }
+
+    sharded_set_lock_all(set);
+
+    error_t err = sharded_set_visit_locked(set, visit, context);
+
+    sharded_set_unlock_all(set);
+
+    return err;
+}
+
+error_t sharded_set_traverse_inorder(const sharded_set_t * const __restrict__ set, FILE *fout) {
+    if (NULL == set) {
+        return SCL_NULL_SHARDED_SET;
+    }
+
+    /* The emptiness test and the traversal see the same keys, no delete runs between them */
+    sharded_set_lock_all(set);
+
+    size_t size = 0;
+
+    for (size_t iter = 0; iter < set->shard_count; ++iter) {
+        size += set->ops->size(set->shards[iter].set);
+    }
+
+    if (0 == size) {
+        sharded_set_unlock_all(set);
+        fprintf(fout, "(Null)\n");
+
+        return SCL_OK;
+    }
+
+    int_writer_t *writer = create_int_writer_stream(fout, INT_WRITER_BUFFER_SIZE);
+
+    if (NULL == writer) {
+        sharded_set_unlock_all(set);
+
+        return SCL_NOT_ENOUGHT_MEM_FOR_OBJ;
+    }
+
+    error_t err = sharded_set_visit_locked(set, int_writer_visit, writer);
+
+    sharded_set_unlock_all(set);
+
+    int_writer_put_bytes(writer, "\n", 1);
+
+    error_t write_err = free_int_writer(writer);
+
+    return (SCL_OK != err) ? err : write_err;
+}
+
+static void* sharded_avl_set_create(size_t capacity_hint, hash_func hash) {
+    return create_sharded_set(&avl_set_ops, SHARDED_SET_DEFAULT_SHARDS, capacity_hint, hash);
+}
+
+static void* sharded_rbk_set_create(size_t capacity_hint, hash_func hash) {
+    return create_sharded_set(&rbk_set_ops, SHARDED_SET_DEFAULT_SHARDS, capacity_hint, hash);
+}
+
+static void* sharded_hash_table_set_create(size_t capacity_hint, hash_func hash) {
+    return create_sharded_set(&hash_table_set_ops, SHARDED_SET_DEFAULT_SHARDS, capacity_hint, hash);
+}
+
+static error_t sharded_set_set_free(void * const set) {
+    return free_sharded_set(set);
+}
+
+static error_t sharded_set_set_insert(void * const set, int32_t key) {
+    return sharded_set_insert(set, key);
+}
+
+static error_t sharded_set_set_delete(void * const set, int32_t key) {
+    return sharded_set_delete(set, key);
+}
+
+static error_t sharded_set_set_modify(void * const set, int32_t old_key, int32_t new_key) {
+    return sharded_set_modify(set, old_key, new_key);
+}
+
+static uint8_t sharded_set_set_includes(const void * const set, int32_t key) {
+    return sharded_set_includes(set, key);
+}
+
+static int32_t sharded_set_set_min(const void * const set) {
+    return sharded_set_get_min(set);
+}
+
+static int32_t sharded_set_set_max(const void * const set) {
+    return sharded_set_get_max(set);
+}
+
+static error_t sharded_set_set_delete_min(void * const set) {
+    return sharded_set_delete_min(set);
+}
+
+static error_t sharded_set_set_delete_max(void * const set) {
+    return sharded_set_delete_max(set);
+}
+
+static error_t sharded_set_set_traverse(const void * const set, FILE *fout) {
+    return sharded_set_traverse_inorder(set, fout);
+}
+
+static error_t sharded_set_set_visit(const void * const set, set_visit_func visit, void *context) {
+    return sharded_set_traverse_visit(set, visit, context);
+}
+
+static size_t sharded_set_set_size(const void * const set) {
+    return get_sharded_set_size(set);
+}
+
+static error_t sharded_set_set_memory_stats(const void * const set, set_memory_stats_t * const stats) {
+    return sharded_set_memory_stats(set, stats);
+}
+
+static size_t sharded_set_set_insert_batch(void * const set, const int32_t * const keys, size_t length) {
+    sharded_set_t * const sharded = set;
+    size_t inserted = 0;
+
+    /* Keys routed to the same shard back to back are inserted under one lock */
+    for (size_t iter = 0; iter < length;) {
+        sharded_set_shard_t *shard = &sharded->shards[sharded_set_shard_index(sharded, keys[iter])];
+
+        pthread_mutex_lock(&shard->lock);
+
+        do {
+            inserted += (SCL_OK == sharded->ops->insert(shard->set, keys[iter]));
+            ++iter;
+        } while ((iter < length) && (shard == &sharded->shards[sharded_set_shard_index(sharded, keys[iter])]));
+
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    return inserted;
+}
+
+static size_t sharded_set_set_delete_batch(void * const set, const int32_t * const keys, size_t length) {
+    sharded_set_t * const sharded = set;
+    size_t deleted = 0;
+
+    for (size_t iter = 0; iter < length;) {
+        sharded_set_shard_t *shard = &sharded->shards[sharded_set_shard_index(sharded, keys[iter])];
+
+        pthread_mutex_lock(&shard->lock);
+
+        do {
+            deleted += (SCL_OK == sharded->ops->delete(shard->set, keys[iter]));
+            ++iter;
+        } while ((iter < length) && (shard == &sharded->shards[sharded_set_shard_index(sharded, keys[iter])]));
+
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    return deleted;
+}
+
+static size_t sharded_set_set_includes_batch(const void * const set, const int32_t * const keys, size_t length, uint8_t * const found) {
+    const sharded_set_t * const sharded = set;
+    size_t found_keys = 0;
+
+    /* Runs of keys of the same shard go to the engine batch, which keeps its own fast path */
+    for (size_t iter = 0; iter < length;) {
+        size_t shard_index = sharded_set_shard_index(sharded, keys[iter]);
+        size_t run_end = iter + 1;
+
+        while ((run_end < length) && (shard_index == sharded_set_shard_index(sharded, keys[run_end]))) {
+            ++run_end;
+        }
+
+        sharded_set_shard_t *shard = &sharded->shards[shard_index];
+
+        pthread_mutex_lock(&shard->lock);
+        found_keys += sharded->ops->includes_batch(shard->set, keys + iter, run_end - iter, found + iter);
+        pthread_mutex_unlock(&shard->lock);
+
+        iter = run_end;
+    }
+
+    return found_keys;
+}
+
+#define SHARDED_SET_OPS(NAME, CREATE)                                           \
+    {                                                                           \
+        .name = NAME,                                                           \
+        .create = CREATE,                                                       \
+        .free = sharded_set_set_free,                                           \
+        .insert = sharded_set_set_insert,                                       \
+        .delete = sharded_set_set_delete,                                       \
+        .modify = sharded_set_set_modify,                                       \
+        .includes = sharded_set_set_includes,                                   \
+        .min = sharded_set_set_min,                                             \
+        .max = sharded_set_set_max,                                             \
+        .delete_min = sharded_set_set_delete_min,                               \
+        .delete_max = sharded_set_set_delete_max,                               \
+        .traverse = sharded_set_set_traverse,                                   \
+        .visit = sharded_set_set_visit,                                         \
+        .size = sharded_set_set_size,                                           \
+        .insert_batch = sharded_set_set_insert_batch,                           \
+        .delete_batch = sharded_set_set_delete_batch,                           \
+        .includes_batch = sharded_set_set_includes_batch,                       \
+        .ordered = 1,                                                           \
+        .memory_stats = sharded_set_set_memory_stats,                           \
+    }
+
+const set_ops_t sharded_avl_set_ops = SHARDED_SET_OPS("sharded_avl", sharded_avl_set_create);
+const set_ops_t sharded_rbk_set_ops = SHARDED_SET_OPS("sharded_rbk", sharded_rbk_set_create);
+const set_ops_t sharded_hash_table_set_ops = SHARDED_SET_OPS("sharded_hash_table", sharded_hash_table_set_create);